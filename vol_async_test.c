@@ -27,6 +27,100 @@ static int test_group(void);
 static int test_link(void);
 static int test_ocopy_orefresh(void);
 static int test_file_reopen(void);
+static int test_async_overlap_benchmark(void);
+
+static int async_overlap_bench_run(hid_t dset_id, hid_t es_id, hbool_t is_write, int *buf,
+                                   double compute_iters_per_sec, double *sync_io_time, double *compute_time,
+                                   double *async_time, double *wait_time);
+static void async_overlap_bench_report(double sync_io_time, double compute_time, double async_time,
+                                       double wait_time);
+
+static int test_event_set_scaling_benchmark(void);
+
+/*
+ * The phases of the event set scaling benchmark. Each phase
+ * queues the same number of operations.
+ */
+typedef enum es_scaling_bench_phase_t {
+    ES_SCALING_BENCH_PHASE_CREATE,
+    ES_SCALING_BENCH_PHASE_WRITE,
+    ES_SCALING_BENCH_PHASE_READ,
+    ES_SCALING_BENCH_NUM_PHASES
+} es_scaling_bench_phase_t;
+
+static const char *es_scaling_bench_phase_names[ES_SCALING_BENCH_NUM_PHASES] = {
+    "H5Gcreate_async/H5Gclose_async",
+    "H5Dwrite_async",
+    "H5Dread_async",
+};
+
+static int es_scaling_bench_run(size_t num_ops, size_t num_es, double *enqueue_times, double *drain_times,
+                                double *mem_per_op);
+
+static int  test_event_set_polling(void);
+static int  async_poll_bench_run(hid_t dset_id, hid_t mspace_id, hid_t fspace_id, hid_t es_id, const int *buf,
+                                 uint64_t timeout, double **poll_times, size_t *num_polls, double *latencies);
+static void async_poll_bench_report(double *poll_times, size_t num_polls, double *latencies);
+
+static int test_event_set_partial_failure(void);
+static int async_err_bench_queue(hid_t file_id, hid_t dset_id, hid_t mspace_id, hid_t fspace_id, hid_t es_id,
+                                 const int *buf, size_t fail_at, hid_t *failed_group_id,
+                                 uint64_t *failed_op_counter);
+static int async_err_bench_count_written(hid_t dset_id, const int *wbuf, int *rbuf, size_t *num_written);
+
+static int  test_async_checkpoint_benchmark(void);
+static void async_ckpt_bench_fill(double *buf, int step);
+static int  async_ckpt_bench_run(hbool_t use_async, double *bufs[2], double compute_iters_per_sec,
+                                 double *sync_io_time, double *elapsed, size_t *peak_mem_growth);
+static int  async_ckpt_bench_verify(double *rbuf, double *expected);
+
+static int test_async_metadata_pipeline_benchmark(void);
+
+/*
+ * The phases of the metadata pipelining benchmark. Each phase
+ * performs ASYNC_MD_BENCH_NUM_OPS operations.
+ */
+typedef enum md_bench_phase_t {
+    MD_BENCH_PHASE_GROUP_CREATE,
+    MD_BENCH_PHASE_LINK_CREATE,
+    MD_BENCH_PHASE_ATTR_WRITE,
+    MD_BENCH_PHASE_OBJ_EXISTS,
+    MD_BENCH_NUM_PHASES
+} md_bench_phase_t;
+
+static const char *md_bench_phase_names[MD_BENCH_NUM_PHASES] = {
+    "group create",
+    "hard link create",
+    "attribute create/write",
+    "H5Oexists_by_name",
+};
+
+static int async_md_bench_run(hid_t file_id, const char *container_name, hid_t es_id, int *attr_vals,
+                              hbool_t *exists, double *phase_times);
+static int async_md_bench_verify(hid_t file_id, const char *container_name, const int *attr_vals,
+                                 const hbool_t *exists);
+
+static int test_async_set_extent_streaming_benchmark(void);
+
+static int test_async_tconv_benchmark(void);
+
+/*
+ * The times measured by the type conversion benchmark, summed over
+ * ASYNC_TCONV_BENCH_NUM_ITERS iterations.
+ */
+typedef struct async_tconv_bench_times_t {
+    double noconv_time;  /* Synchronous I/O without conversion */
+    double sync_time;    /* Synchronous I/O with conversion */
+    double compute_time; /* Computation on its own */
+    double call_time;    /* Inside the H5Dwrite_async/H5Dread_async call */
+    double wait_time;    /* In H5ESwait after computing */
+    double async_time;   /* Async I/O overlapped with computation */
+} async_tconv_bench_times_t;
+
+static int  async_tconv_bench_run(hid_t dset_id, hid_t mem_type_id, hid_t file_type_id, hid_t es_id,
+                                  hbool_t is_write, void *buf, void *raw_buf, double compute_iters_per_sec,
+                                  async_tconv_bench_times_t *times);
+static void async_tconv_bench_report(const char *op_name, const async_tconv_bench_times_t *times);
 
 /*
  * The array of async tests to be performed.
@@ -45,6 +139,14 @@ static int (*async_tests[])(void) = {
     test_link,
     test_ocopy_orefresh,
     test_file_reopen,
+    test_async_overlap_benchmark,
+    test_event_set_scaling_benchmark,
+    test_event_set_polling,
+    test_event_set_partial_failure,
+    test_async_checkpoint_benchmark,
+    test_async_metadata_pipeline_benchmark,
+    test_async_set_extent_streaming_benchmark,
+    test_async_tconv_benchmark,
 };
 
 /* Highest "printf" file created (starting at 0) */
@@ -85,7 +187,7 @@ test_one_dataset_io(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Create file asynchronously */
@@ -353,7 +455,7 @@ test_multi_dataset_io(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Create file asynchronously */
@@ -608,7 +710,7 @@ test_multi_file_dataset_io(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     PASSED();
@@ -919,7 +1021,7 @@ test_multi_file_grp_dset_io(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     PASSED();
@@ -1251,7 +1353,7 @@ test_set_extent(void)
             wbuf[i][j] = 10 * i + j;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Create file asynchronously */
@@ -1438,7 +1540,7 @@ test_attribute_exists(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Open file asynchronously */
@@ -1559,7 +1661,7 @@ test_attribute_io(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Open file asynchronously */
@@ -1701,7 +1803,7 @@ test_attribute_io_tconv(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Open file asynchronously */
@@ -1872,7 +1974,7 @@ test_attribute_io_compound(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Open file asynchronously */
@@ -2159,7 +2261,7 @@ test_group(void)
     }
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Open file asynchronously */
@@ -2328,7 +2430,7 @@ test_link(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Open file asynchronously */
@@ -2515,7 +2617,7 @@ test_ocopy_orefresh(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Open file asynchronously */
@@ -2620,7 +2722,7 @@ test_file_reopen(void)
     }
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Open file asynchronously */
@@ -2670,44 +2772,2676 @@ error:
 } /* end test_file_reopen() */
 
 /*
- * Cleanup temporary test files
+ * A benchmark to measure how well async dataset I/O overlaps with
+ * computation. For both writes and reads, the I/O is first timed on
+ * its own using the synchronous API, and a compute kernel is timed on
+ * its own. Then the async I/O is issued, the compute kernel is run,
+ * and H5ESwait is called, and the total time is compared with the
+ * synchronous baseline to determine how much of the shorter of the
+ * two was hidden behind the longer one.
  */
-static void
-cleanup_files(void)
+static int
+test_async_overlap_benchmark(void)
 {
-    char file_name[64];
-    int  i;
+    hsize_t dims[1] = {ASYNC_OVERLAP_BENCH_NUM_ELEMS};
+    size_t  num_in_progress;
+    size_t  i;
+    hbool_t op_failed;
+    double  compute_iters_per_sec;
+    double  sync_io_time, compute_time, async_time, wait_time;
+    hid_t   file_id  = H5I_INVALID_HID;
+    hid_t   dset_id  = H5I_INVALID_HID;
+    hid_t   space_id = H5I_INVALID_HID;
+    hid_t   es_id    = H5I_INVALID_HID;
+    int    *wbuf     = NULL;
+    int    *rbuf     = NULL;
 
-    H5Fdelete(ASYNC_VOL_TEST_FILE, H5P_DEFAULT);
-    for (i = 0; i <= max_printf_file; i++) {
-        HDsnprintf(file_name, 64, ASYNC_VOL_TEST_FILE_PRINTF, i);
-        H5Fdelete(file_name, H5P_DEFAULT);
-    } /* end for */
-}
+    TESTING_MULTIPART("async I/O and compute overlap benchmark");
 
-int
-vol_async_test(void)
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file or dataset aren't supported with this connector\n");
+        return 0;
+    }
+
+    TESTING_2("test setup");
+
+    if (NULL == (wbuf = HDmalloc(ASYNC_OVERLAP_BENCH_NUM_ELEMS * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (rbuf = HDmalloc(ASYNC_OVERLAP_BENCH_NUM_ELEMS * sizeof(int))))
+        TEST_ERROR;
+
+    for (i = 0; i < ASYNC_OVERLAP_BENCH_NUM_ELEMS; i++)
+        wbuf[i] = (int)i;
+
+    /* Create dataspace */
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+
+    /* Create event stack */
+    if ((es_id = create_test_event_set()) < 0)
+        TEST_ERROR;
+
+    /* Create file and dataset synchronously so their creation isn't part of the timings */
+    if ((file_id = H5Fcreate(ASYNC_OVERLAP_BENCH_FILE, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((dset_id = H5Dcreate2(file_id, ASYNC_OVERLAP_BENCH_DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    compute_iters_per_sec = calibrate_compute_kernel();
+
+    PASSED();
+
+    BEGIN_MULTIPART
+    {
+        PART_BEGIN(overlap_write)
+        {
+            TESTING_2("overlap of H5Dwrite_async() with computation");
+
+            if (async_overlap_bench_run(dset_id, es_id, TRUE, wbuf, compute_iters_per_sec, &sync_io_time,
+                                        &compute_time, &async_time, &wait_time) < 0)
+                PART_TEST_ERROR(overlap_write);
+
+            PASSED();
+
+            async_overlap_bench_report(sync_io_time, compute_time, async_time, wait_time);
+        }
+        PART_END(overlap_write);
+
+        PART_BEGIN(overlap_read)
+        {
+            TESTING_2("overlap of H5Dread_async() with computation");
+
+            memset(rbuf, 0, ASYNC_OVERLAP_BENCH_NUM_ELEMS * sizeof(int));
+
+            if (async_overlap_bench_run(dset_id, es_id, FALSE, rbuf, compute_iters_per_sec, &sync_io_time,
+                                        &compute_time, &async_time, &wait_time) < 0)
+                PART_TEST_ERROR(overlap_read);
+
+            /* Verify the read data */
+            for (i = 0; i < ASYNC_OVERLAP_BENCH_NUM_ELEMS; i++)
+                if (rbuf[i] != wbuf[i]) {
+                    H5_FAILED();
+                    HDprintf("    data verification failed at index %zu\n", i);
+                    PART_ERROR(overlap_read);
+                } /* end if */
+
+            PASSED();
+
+            async_overlap_bench_report(sync_io_time, compute_time, async_time, wait_time);
+        }
+        PART_END(overlap_read);
+    }
+    END_MULTIPART;
+
+    TESTING_2("test cleanup");
+
+    /* Wait for the event stack to complete */
+    if (H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+        TEST_ERROR;
+    if (op_failed)
+        TEST_ERROR;
+
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+    if (H5ESclose(es_id) < 0)
+        TEST_ERROR;
+
+    HDfree(rbuf);
+    HDfree(wbuf);
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(space_id);
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+        H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed);
+        H5ESclose(es_id);
+    }
+    H5E_END_TRY;
+
+    HDfree(rbuf);
+    HDfree(wbuf);
+
+    return 1;
+} /* end test_async_overlap_benchmark() */
+
+/*
+ * Runs the overlap benchmark for either writes or reads, returning
+ * the total time spent over ASYNC_OVERLAP_BENCH_NUM_ITERS iterations
+ * on synchronous I/O alone, on computation alone, on async I/O
+ * overlapped with computation and on waiting for the async I/O to
+ * complete after the computation finished.
+ */
+static int
+async_overlap_bench_run(hid_t dset_id, hid_t es_id, hbool_t is_write, int *buf, double compute_iters_per_sec,
+                        double *sync_io_time, double *compute_time, double *async_time, double *wait_time)
 {
-    size_t i;
-    int    nerrors;
+    const char *compute_time_str = HDgetenv(HDF5_API_TEST_ASYNC_COMPUTE_TIME);
+    size_t      num_in_progress;
+    size_t      compute_iters;
+    size_t      i;
+    hbool_t     op_failed;
+    double      start_time, wait_start_time, iter_io_time;
+    herr_t      status;
+
+    *sync_io_time = *compute_time = *async_time = *wait_time = 0.0;
+
+    for (i = 0; i < ASYNC_OVERLAP_BENCH_NUM_ITERS; i++) {
+        /* Time the I/O on its own with the synchronous API */
+        start_time = get_wall_time();
+
+        if (is_write)
+            status = H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+        else
+            status = H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+
+        if (status < 0) {
+            HDprintf("    synchronous dataset %s failed\n", is_write ? "write" : "read");
+            return -1;
+        }
 
-    HDprintf("**********************************************\n");
-    HDprintf("*                                            *\n");
-    HDprintf("*             VOL Async Tests                *\n");
-    HDprintf("*                                            *\n");
-    HDprintf("**********************************************\n\n");
+        iter_io_time = get_wall_time() - start_time;
+        *sync_io_time += iter_io_time;
+
+        /*
+         * Unless a compute time was given, match the compute time to the
+         * I/O time, so that perfect overlap would hide all of the I/O.
+         */
+        if (compute_time_str && HDatof(compute_time_str) > 0.0)
+            compute_iters = (size_t)(HDatof(compute_time_str) * compute_iters_per_sec);
+        else
+            compute_iters = (size_t)(iter_io_time * compute_iters_per_sec);
+
+        /* Time the computation on its own */
+        start_time = get_wall_time();
+        run_compute_kernel(compute_iters);
+        *compute_time += get_wall_time() - start_time;
+
+        /* Issue the async I/O, compute, then wait for the I/O to complete */
+        start_time = get_wall_time();
+
+        if (is_write)
+            status = H5Dwrite_async(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf, es_id);
+        else
+            status = H5Dread_async(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf, es_id);
+
+        if (status < 0) {
+            HDprintf("    async dataset %s failed\n", is_write ? "write" : "read");
+            return -1;
+        }
+
+        run_compute_kernel(compute_iters);
+
+        wait_start_time = get_wall_time();
+
+        if (H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+            return -1;
+        if (op_failed) {
+            HDprintf("    async dataset %s failed\n", is_write ? "write" : "read");
+            return -1;
+        }
+
+        *wait_time += get_wall_time() - wait_start_time;
+        *async_time += get_wall_time() - start_time;
+    }
+
+    return 0;
+} /* end async_overlap_bench_run() */
+
+/*
+ * Prints the results of the overlap benchmark. The overlap fraction
+ * is the amount of time saved by overlapping the I/O and computation
+ * as a fraction of the most that could have been saved, which is the
+ * shorter of the two.
+ */
+static void
+async_overlap_bench_report(double sync_io_time, double compute_time, double async_time, double wait_time)
+{
+    double data_size    = (double)ASYNC_OVERLAP_BENCH_NUM_ELEMS * sizeof(int) * ASYNC_OVERLAP_BENCH_NUM_ITERS;
+    double max_saving   = MIN(sync_io_time, compute_time);
+    double overlap_frac = 0.0;
+
+    if (max_saving > 0.0)
+        overlap_frac = (sync_io_time + compute_time - async_time) / max_saving;
+    overlap_frac = MAX(0.0, MIN(1.0, overlap_frac));
+
+    HDprintf("    sync I/O: %.6f s (%.2f MiB/s), compute: %.6f s, async I/O + compute: %.6f s "
+             "(%.6f s in H5ESwait)\n",
+             sync_io_time, (sync_io_time > 0.0) ? data_size / (1024.0 * 1024.0) / sync_io_time : 0.0,
+             compute_time, async_time, wait_time);
+    HDprintf("    overlap fraction: %.2f%% (over %d iterations)\n", overlap_frac * 100.0,
+             ASYNC_OVERLAP_BENCH_NUM_ITERS);
+} /* end async_overlap_bench_report() */
+
+/*
+ * A benchmark to measure how event sets behave with thousands of
+ * operations in flight. For each number of operations and event
+ * sets, the same number of operations is queued in each of three
+ * phases: group creates and closes, single-element dataset writes
+ * and single-element dataset reads. Operations are spread round-robin
+ * over the event sets. Each element is written twice, by operations
+ * that are queued far apart, and then read back, which checks that
+ * the connector orders dependent operations correctly. Since HDF5
+ * only orders operations within an event set, all operations on an
+ * element go to the same event set, chosen by the element's index
+ * modulo the number of event sets. The cost of queueing each
+ * operation, the time H5ESwait takes to drain the event sets and the
+ * memory used by each pending write are reported.
+ */
+static int
+test_event_set_scaling_benchmark(void)
+{
+    size_t op_counts[] = ASYNC_ES_SCALING_BENCH_OP_COUNTS;
+    size_t es_counts[] = ASYNC_ES_SCALING_BENCH_ES_COUNTS;
+    size_t i, j, k;
+    double enqueue_times[ES_SCALING_BENCH_NUM_PHASES];
+    double drain_times[ES_SCALING_BENCH_NUM_PHASES];
+    double mem_per_op;
+
+    TESTING_MULTIPART("event set scaling benchmark");
 
     /* Make sure the connector supports the API functions being tested */
-    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_ASYNC)) {
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC)) {
         SKIPPED();
-        HDprintf("    Async APIs aren't supported with this connector\n");
+        HDprintf(
+            "    API functions for basic file, group, or dataset aren't supported with this connector\n");
         return 0;
     }
 
-    for (i = 0, nerrors = 0; i < ARRAY_LENGTH(async_tests); i++) {
-        nerrors += (*async_tests[i])() ? 1 : 0;
+    BEGIN_MULTIPART
+    {
+        for (i = 0; i < ARRAY_LENGTH(op_counts); i++) {
+            for (j = 0; j < ARRAY_LENGTH(es_counts); j++) {
+                PART_BEGIN(es_scaling)
+                {
+                    char test_name[128];
+
+                    HDsnprintf(test_name, sizeof(test_name), "%zu operations per phase on %zu event set(s)",
+                               op_counts[i], es_counts[j]);
+
+                    TESTING_2(test_name);
+
+                    if (es_scaling_bench_run(op_counts[i], es_counts[j], enqueue_times, drain_times,
+                                             &mem_per_op) < 0)
+                        PART_TEST_ERROR(es_scaling);
+
+                    PASSED();
+
+                    for (k = 0; k < ES_SCALING_BENCH_NUM_PHASES; k++)
+                        HDprintf("    %-31s enqueue: %8.2f us/op, H5ESwait drain: %.6f s (%.0f ops/s)\n",
+                                 es_scaling_bench_phase_names[k],
+                                 enqueue_times[k] / (double)op_counts[i] * 1.0E6, drain_times[k],
+                                 (enqueue_times[k] + drain_times[k] > 0.0)
+                                     ? (double)op_counts[i] / (enqueue_times[k] + drain_times[k])
+                                     : 0.0);
+                    HDprintf("    memory per pending H5Dwrite_async: %.0f bytes\n", mem_per_op);
+                }
+                PART_END(es_scaling);
+            }
+        }
+    }
+    END_MULTIPART;
+
+    return 0;
+
+error:
+    return 1;
+} /* end test_event_set_scaling_benchmark() */
+
+/*
+ * Runs the event set scaling benchmark for a given number of
+ * operations per phase and event sets, returning the time spent
+ * queueing and draining the operations of each phase and the
+ * growth in resident memory per pending write.
+ */
+static int
+es_scaling_bench_run(size_t num_ops, size_t num_es, double *enqueue_times, double *drain_times,
+                     double *mem_per_op)
+{
+    H5G_info_t group_info;
+    hsize_t    dims[1];
+    hsize_t    start[1];
+    hsize_t    count[1] = {1};
+    size_t     num_elems = num_ops / 2;
+    size_t     num_in_progress;
+    size_t     num_pending, es_count;
+    size_t     mem_before, mem_after;
+    size_t     i;
+    hbool_t    op_failed;
+    double     start_time;
+    char       group_name[64];
+    hid_t     *es_ids    = NULL;
+    hid_t      file_id   = H5I_INVALID_HID;
+    hid_t      group_id  = H5I_INVALID_HID;
+    hid_t      dset_id   = H5I_INVALID_HID;
+    hid_t      fspace_id = H5I_INVALID_HID;
+    hid_t      mspace_id = H5I_INVALID_HID;
+    int       *wbuf      = NULL;
+    int       *rbuf      = NULL;
+    int        ret_value = -1;
+
+    for (i = 0; i < ES_SCALING_BENCH_NUM_PHASES; i++)
+        enqueue_times[i] = drain_times[i] = 0.0;
+    *mem_per_op = 0.0;
+
+    if (NULL == (es_ids = HDmalloc(num_es * sizeof(hid_t))))
+        goto done;
+    for (i = 0; i < num_es; i++)
+        es_ids[i] = H5I_INVALID_HID;
+
+    /* Each operation needs its own buffer element, since it may not complete until the event sets drain */
+    if (NULL == (wbuf = HDmalloc(num_ops * sizeof(int))))
+        goto done;
+    if (NULL == (rbuf = HDmalloc(num_ops * sizeof(int))))
+        goto done;
+
+    for (i = 0; i < num_ops; i++) {
+        wbuf[i] = (int)i;
+        rbuf[i] = -1;
+    }
+
+    for (i = 0; i < num_es; i++)
+        if ((es_ids[i] = create_test_event_set()) < 0)
+            goto done;
+
+    /* Create file and dataset synchronously so their creation isn't part of the timings */
+    if ((file_id = H5Fcreate(ASYNC_ES_SCALING_BENCH_FILE, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto done;
+
+    dims[0] = num_elems;
+
+    if ((fspace_id = H5Screate_simple(1, dims, NULL)) < 0)
+        goto done;
+    if ((mspace_id = H5Screate_simple(1, count, NULL)) < 0)
+        goto done;
+
+    if ((dset_id = H5Dcreate2(file_id, ASYNC_ES_SCALING_BENCH_DSET_NAME, H5T_NATIVE_INT, fspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto done;
+
+    /* Queue group creates and closes */
+    start_time = get_wall_time();
+
+    for (i = 0; i < num_elems; i++) {
+        HDsnprintf(group_name, sizeof(group_name), "group%zu", i);
+
+        if ((group_id = H5Gcreate_async(file_id, group_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT,
+                                        es_ids[i % num_es])) < 0)
+            goto done;
+        if (H5Gclose_async(group_id, es_ids[i % num_es]) < 0)
+            goto done;
+        group_id = H5I_INVALID_HID;
+    }
+
+    enqueue_times[ES_SCALING_BENCH_PHASE_CREATE] = get_wall_time() - start_time;
+
+    start_time = get_wall_time();
+
+    for (i = 0; i < num_es; i++) {
+        if (H5ESwait(es_ids[i], VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+            goto done;
+        if (op_failed)
+            goto done;
     }
 
+    drain_times[ES_SCALING_BENCH_PHASE_CREATE] = get_wall_time() - start_time;
+
+    /*
+     * Queue writes, writing each element twice. Operation i and
+     * i + num_elems write the same element, so the final value of
+     * element j should be j + num_elems. Operations are only ordered
+     * within an event set, so both writes of an element are queued
+     * in the same event set.
+     */
+    mem_before = get_resident_memory();
+
+    start_time = get_wall_time();
+
+    for (i = 0; i < num_ops; i++) {
+        start[0] = i % num_elems;
+
+        if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            goto done;
+
+        if (H5Dwrite_async(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT, &wbuf[i],
+                           es_ids[start[0] % num_es]) < 0)
+            goto done;
+    }
+
+    enqueue_times[ES_SCALING_BENCH_PHASE_WRITE] = get_wall_time() - start_time;
+
+    for (i = 0, num_pending = 0; i < num_es; i++) {
+        if (H5ESget_count(es_ids[i], &es_count) < 0)
+            goto done;
+        num_pending += es_count;
+    }
+
+    if (num_pending > 0 && mem_before > 0 && (mem_after = get_resident_memory()) > mem_before)
+        *mem_per_op = (double)(mem_after - mem_before) / (double)num_pending;
+
+    start_time = get_wall_time();
+
+    for (i = 0; i < num_es; i++) {
+        if (H5ESwait(es_ids[i], VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+            goto done;
+        if (op_failed)
+            goto done;
+    }
+
+    drain_times[ES_SCALING_BENCH_PHASE_WRITE] = get_wall_time() - start_time;
+
+    /* Queue reads, reading each element twice from the event set that wrote it */
+    start_time = get_wall_time();
+
+    for (i = 0; i < num_ops; i++) {
+        start[0] = i % num_elems;
+
+        if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            goto done;
+
+        if (H5Dread_async(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT, &rbuf[i],
+                          es_ids[start[0] % num_es]) < 0)
+            goto done;
+    }
+
+    enqueue_times[ES_SCALING_BENCH_PHASE_READ] = get_wall_time() - start_time;
+
+    start_time = get_wall_time();
+
+    for (i = 0; i < num_es; i++) {
+        if (H5ESwait(es_ids[i], VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+            goto done;
+        if (op_failed)
+            goto done;
+    }
+
+    drain_times[ES_SCALING_BENCH_PHASE_READ] = get_wall_time() - start_time;
+
+    /* Verify that the later write of each element took effect */
+    for (i = 0; i < num_ops; i++)
+        if (rbuf[i] != (int)((i % num_elems) + num_elems)) {
+            HDprintf("    element %zu was %d instead of %d; dependent operations were reordered\n",
+                     i % num_elems, rbuf[i], (int)((i % num_elems) + num_elems));
+            goto done;
+        }
+
+    /* Verify that all of the groups were created */
+    if (H5Gget_info(file_id, &group_info) < 0)
+        goto done;
+
+    if (group_info.nlinks != num_elems + 1) {
+        HDprintf("    file contained %llu links instead of %zu\n", (unsigned long long)group_info.nlinks,
+                 num_elems + 1);
+        goto done;
+    }
+
+    ret_value = 0;
+
+done:
+    H5E_BEGIN_TRY
+    {
+        H5Gclose(group_id);
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+        for (i = 0; es_ids && i < num_es; i++) {
+            H5ESwait(es_ids[i], VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed);
+            H5ESclose(es_ids[i]);
+        }
+    }
+    H5E_END_TRY;
+
+    HDfree(rbuf);
+    HDfree(wbuf);
+    HDfree(es_ids);
+
+    return ret_value;
+} /* end es_scaling_bench_run() */
+
+/*
+ * Tests driving async operations to completion without blocking,
+ * as an event loop would, and a benchmark of what that costs. A
+ * batch of single-element dataset writes is queued and then polled
+ * with H5ESwait, using first a zero timeout and then a short one,
+ * until no operations remain in progress. The time taken by each
+ * poll and the latency from queueing each operation to a poll
+ * observing its completion are reported.
+ */
+static int
+test_event_set_polling(void)
+{
+    hsize_t  dims[1]  = {ASYNC_POLL_BENCH_NUM_OPS};
+    hsize_t  start[1] = {0};
+    hsize_t  count[1] = {1};
+    uint64_t op_counter_before, op_counter_after;
+    size_t   num_in_progress;
+    size_t   es_count;
+    size_t   num_polls;
+    size_t   i;
+    hbool_t  op_failed;
+    hid_t    file_id    = H5I_INVALID_HID;
+    hid_t    dset_id    = H5I_INVALID_HID;
+    hid_t    fspace_id  = H5I_INVALID_HID;
+    hid_t    mspace_id  = H5I_INVALID_HID;
+    hid_t    es_id      = H5I_INVALID_HID;
+    int     *wbuf       = NULL;
+    int     *rbuf       = NULL;
+    double  *poll_times = NULL;
+    double  *latencies  = NULL;
+
+    TESTING_MULTIPART("event set polling");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file or dataset aren't supported with this connector\n");
+        return 0;
+    }
+
+    TESTING_2("test setup");
+
+    if (NULL == (wbuf = HDmalloc(ASYNC_POLL_BENCH_NUM_OPS * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (rbuf = HDmalloc(ASYNC_POLL_BENCH_NUM_OPS * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (latencies = HDmalloc(ASYNC_POLL_BENCH_NUM_OPS * sizeof(double))))
+        TEST_ERROR;
+
+    /* Create dataspaces */
+    if ((fspace_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((mspace_id = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR;
+
+    /* Create event stack */
+    if ((es_id = create_test_event_set()) < 0)
+        TEST_ERROR;
+
+    /* Create file and dataset synchronously so their creation isn't part of the timings */
+    if ((file_id = H5Fcreate(ASYNC_POLL_BENCH_FILE, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((dset_id = H5Dcreate2(file_id, ASYNC_POLL_BENCH_DSET_NAME, H5T_NATIVE_INT, fspace_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    BEGIN_MULTIPART
+    {
+        PART_BEGIN(es_get_count_op_counter)
+        {
+            TESTING_2("H5ESget_count() and H5ESget_op_counter()");
+
+            if (H5ESget_op_counter(es_id, &op_counter_before) < 0)
+                PART_TEST_ERROR(es_get_count_op_counter);
+
+            for (i = 0; i < ASYNC_POLL_BENCH_NUM_OPS; i++) {
+                wbuf[i]  = (int)i;
+                start[0] = i;
+
+                if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                    PART_TEST_ERROR(es_get_count_op_counter);
+
+                if (H5Dwrite_async(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT, &wbuf[i],
+                                   es_id) < 0)
+                    PART_TEST_ERROR(es_get_count_op_counter);
+            }
+
+            /* Every queued operation should be counted, whether or not it has completed */
+            if (H5ESget_op_counter(es_id, &op_counter_after) < 0)
+                PART_TEST_ERROR(es_get_count_op_counter);
+
+            if (op_counter_after - op_counter_before != ASYNC_POLL_BENCH_NUM_OPS) {
+                H5_FAILED();
+                HDprintf("    operation counter increased by %llu instead of %d\n",
+                         (unsigned long long)(op_counter_after - op_counter_before),
+                         ASYNC_POLL_BENCH_NUM_OPS);
+                PART_ERROR(es_get_count_op_counter);
+            }
+
+            if (H5ESget_count(es_id, &es_count) < 0)
+                PART_TEST_ERROR(es_get_count_op_counter);
+
+            if (es_count > ASYNC_POLL_BENCH_NUM_OPS) {
+                H5_FAILED();
+                HDprintf("    event set contained %zu operations, more than the %d queued\n", es_count,
+                         ASYNC_POLL_BENCH_NUM_OPS);
+                PART_ERROR(es_get_count_op_counter);
+            }
+
+            if (H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+                PART_TEST_ERROR(es_get_count_op_counter);
+            if (op_failed)
+                PART_TEST_ERROR(es_get_count_op_counter);
+
+            /* Completed operations leave the event set but remain counted */
+            if (H5ESget_count(es_id, &es_count) < 0)
+                PART_TEST_ERROR(es_get_count_op_counter);
+
+            if (es_count != 0) {
+                H5_FAILED();
+                HDprintf("    event set still contained %zu operations after waiting\n", es_count);
+                PART_ERROR(es_get_count_op_counter);
+            }
+
+            if (H5ESget_op_counter(es_id, &op_counter_before) < 0)
+                PART_TEST_ERROR(es_get_count_op_counter);
+
+            if (op_counter_before != op_counter_after) {
+                H5_FAILED();
+                HDprintf("    operation counter changed from %llu to %llu while waiting\n",
+                         (unsigned long long)op_counter_after, (unsigned long long)op_counter_before);
+                PART_ERROR(es_get_count_op_counter);
+            }
+
+            PASSED();
+        }
+        PART_END(es_get_count_op_counter);
+
+        PART_BEGIN(poll_zero_timeout)
+        {
+            TESTING_2("completion by polling H5ESwait() with a zero timeout");
+
+            for (i = 0; i < ASYNC_POLL_BENCH_NUM_OPS; i++)
+                wbuf[i] = (int)i + ASYNC_POLL_BENCH_NUM_OPS;
+
+            if (async_poll_bench_run(dset_id, mspace_id, fspace_id, es_id, wbuf, VOL_TEST_WAIT_NONE,
+                                     &poll_times, &num_polls, latencies) < 0)
+                PART_TEST_ERROR(poll_zero_timeout);
+
+            if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+                PART_TEST_ERROR(poll_zero_timeout);
+
+            for (i = 0; i < ASYNC_POLL_BENCH_NUM_OPS; i++)
+                if (rbuf[i] != wbuf[i]) {
+                    H5_FAILED();
+                    HDprintf("    data verification failed at index %zu\n", i);
+                    PART_ERROR(poll_zero_timeout);
+                } /* end if */
+
+            PASSED();
+
+            async_poll_bench_report(poll_times, num_polls, latencies);
+        }
+        PART_END(poll_zero_timeout);
+
+        HDfree(poll_times);
+        poll_times = NULL;
+
+        PART_BEGIN(poll_short_timeout)
+        {
+            TESTING_2("completion by polling H5ESwait() with a short timeout");
+
+            for (i = 0; i < ASYNC_POLL_BENCH_NUM_OPS; i++)
+                wbuf[i] = (int)i + 2 * ASYNC_POLL_BENCH_NUM_OPS;
+
+            if (async_poll_bench_run(dset_id, mspace_id, fspace_id, es_id, wbuf,
+                                     ASYNC_POLL_BENCH_WAIT_TIMEOUT, &poll_times, &num_polls, latencies) < 0)
+                PART_TEST_ERROR(poll_short_timeout);
+
+            if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+                PART_TEST_ERROR(poll_short_timeout);
+
+            for (i = 0; i < ASYNC_POLL_BENCH_NUM_OPS; i++)
+                if (rbuf[i] != wbuf[i]) {
+                    H5_FAILED();
+                    HDprintf("    data verification failed at index %zu\n", i);
+                    PART_ERROR(poll_short_timeout);
+                } /* end if */
+
+            PASSED();
+
+            async_poll_bench_report(poll_times, num_polls, latencies);
+        }
+        PART_END(poll_short_timeout);
+
+        HDfree(poll_times);
+        poll_times = NULL;
+    }
+    END_MULTIPART;
+
+    TESTING_2("test cleanup");
+
+    /* Wait for the event stack to complete */
+    if (H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+        TEST_ERROR;
+    if (op_failed)
+        TEST_ERROR;
+
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR;
+    if (H5ESclose(es_id) < 0)
+        TEST_ERROR;
+
+    HDfree(latencies);
+    HDfree(rbuf);
+    HDfree(wbuf);
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+        H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed);
+        H5ESclose(es_id);
+    }
+    H5E_END_TRY;
+
+    HDfree(poll_times);
+    HDfree(latencies);
+    HDfree(rbuf);
+    HDfree(wbuf);
+
+    return 1;
+} /* end test_event_set_polling() */
+
+/*
+ * Queues ASYNC_POLL_BENCH_NUM_OPS single-element writes of buf to
+ * the dataset, then polls the event set with H5ESwait and the given
+ * timeout until none of the writes are in progress. The time taken
+ * by each poll is returned in *poll_times, which is allocated here
+ * and must be freed by the caller. Since all of the writes are to
+ * the same dataset, they complete in the order they were queued, so
+ * when a poll finds k writes still in progress, all but the last k
+ * are known to have completed; their latencies are measured up to
+ * the end of the first poll that observed it.
+ */
+static int
+async_poll_bench_run(hid_t dset_id, hid_t mspace_id, hid_t fspace_id, hid_t es_id, const int *buf,
+                     uint64_t timeout, double **poll_times, size_t *num_polls, double *latencies)
+{
+    hsize_t start[1];
+    hsize_t count[1]        = {1};
+    size_t  poll_times_size = 1024;
+    size_t  num_in_progress = ASYNC_POLL_BENCH_NUM_OPS;
+    size_t  prev_in_progress;
+    size_t  num_completed = 0;
+    size_t  es_count;
+    size_t  i;
+    hbool_t op_failed;
+    double  poll_start;
+    double *enqueue_times = NULL;
+    double *tmp_realloc   = NULL;
+    int     ret_value     = -1;
+
+    *num_polls = 0;
+
+    if (NULL == (*poll_times = HDmalloc(poll_times_size * sizeof(double))))
+        goto done;
+    if (NULL == (enqueue_times = HDmalloc(ASYNC_POLL_BENCH_NUM_OPS * sizeof(double))))
+        goto done;
+
+    for (i = 0; i < ASYNC_POLL_BENCH_NUM_OPS; i++) {
+        start[0] = i;
+
+        if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            goto done;
+
+        enqueue_times[i] = get_wall_time();
+
+        if (H5Dwrite_async(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT, &buf[i], es_id) < 0)
+            goto done;
+    }
+
+    while (num_in_progress > 0) {
+        if (*num_polls == poll_times_size) {
+            poll_times_size *= 2;
+
+            if (NULL == (tmp_realloc = HDrealloc(*poll_times, poll_times_size * sizeof(double))))
+                goto done;
+            *poll_times = tmp_realloc;
+        }
+
+        prev_in_progress = num_in_progress;
+        poll_start       = get_wall_time();
+
+        if (H5ESwait(es_id, timeout, &num_in_progress, &op_failed) < 0)
+            goto done;
+
+        (*poll_times)[*num_polls] = get_wall_time() - poll_start;
+
+        if (op_failed) {
+            HDprintf("    async dataset write failed\n");
+            goto done;
+        }
+
+        /* No operations are being queued, so the number in progress can only go down */
+        if (num_in_progress > prev_in_progress) {
+            HDprintf("    number of operations in progress rose from %zu to %zu\n", prev_in_progress,
+                     num_in_progress);
+            goto done;
+        }
+
+        if (H5ESget_count(es_id, &es_count) < 0)
+            goto done;
+
+        if (es_count > num_in_progress) {
+            HDprintf("    event set contained %zu operations, but only %zu were in progress\n", es_count,
+                     num_in_progress);
+            goto done;
+        }
+
+        for (; num_completed < ASYNC_POLL_BENCH_NUM_OPS - num_in_progress; num_completed++)
+            latencies[num_completed] = poll_start + (*poll_times)[*num_polls] - enqueue_times[num_completed];
+
+        (*num_polls)++;
+    }
+
+    ret_value = 0;
+
+done:
+    HDfree(enqueue_times);
+
+    return ret_value;
+} /* end async_poll_bench_run() */
+
+/*
+ * Prints the distribution of the time taken by each poll and of the
+ * latency from queueing each operation to a poll observing its
+ * completion. Both arrays are sorted in place.
+ */
+static void
+async_poll_bench_report(double *poll_times, size_t num_polls, double *latencies)
+{
+    sort_timings(poll_times, num_polls);
+    sort_timings(latencies, ASYNC_POLL_BENCH_NUM_OPS);
+
+    HDprintf("    %zu polls for %d operations; per-poll time (us): min %.2f, median %.2f, 99th %.2f, "
+             "max %.2f\n",
+             num_polls, ASYNC_POLL_BENCH_NUM_OPS, num_polls ? poll_times[0] * 1.0E6 : 0.0,
+             get_timing_percentile(poll_times, num_polls, 50.0) * 1.0E6,
+             get_timing_percentile(poll_times, num_polls, 99.0) * 1.0E6,
+             num_polls ? poll_times[num_polls - 1] * 1.0E6 : 0.0);
+    HDprintf("    completion latency (ms): median %.3f, 90th %.3f, 99th %.3f, max %.3f\n",
+             get_timing_percentile(latencies, ASYNC_POLL_BENCH_NUM_OPS, 50.0) * 1.0E3,
+             get_timing_percentile(latencies, ASYNC_POLL_BENCH_NUM_OPS, 90.0) * 1.0E3,
+             get_timing_percentile(latencies, ASYNC_POLL_BENCH_NUM_OPS, 99.0) * 1.0E3,
+             latencies[ASYNC_POLL_BENCH_NUM_OPS - 1] * 1.0E3);
+} /* end async_poll_bench_report() */
+
+/*
+ * Tests that a failure in the middle of a large batch of async
+ * operations is reported correctly by the event set and doesn't
+ * stall the rest of the batch. A batch of single-element dataset
+ * writes is first run without failures as a baseline. The same batch
+ * is then run with an operation that can only fail once it executes,
+ * creating a group that already exists, queued halfway through. The
+ * error information the event set reports is checked, the number of
+ * writes that completed and were canceled is counted and the time
+ * taken to drain the failed batch is compared with the baseline.
+ * Finally, the event set is checked to still be usable.
+ */
+static int
+test_event_set_partial_failure(void)
+{
+    H5ES_err_info_t  err_info;
+    H5ES_err_info_t *remaining_err_info = NULL;
+    hsize_t          dims[1]            = {ASYNC_ERR_BENCH_NUM_OPS};
+    hsize_t          count[1]           = {1};
+    uint64_t         failed_op_counter;
+    size_t           num_in_progress;
+    size_t           num_err, num_cleared;
+    size_t           num_written;
+    size_t           i;
+    hbool_t          op_failed;
+    hbool_t          err_occurred;
+    double           start_time;
+    double           baseline_drain_time = 0.0, failed_drain_time;
+    hid_t            file_id         = H5I_INVALID_HID;
+    hid_t            group_id        = H5I_INVALID_HID;
+    hid_t            dset_id         = H5I_INVALID_HID;
+    hid_t            fspace_id       = H5I_INVALID_HID;
+    hid_t            mspace_id       = H5I_INVALID_HID;
+    hid_t            failed_group_id = H5I_INVALID_HID;
+    hid_t            es_id           = H5I_INVALID_HID;
+    int             *wbuf            = NULL;
+    int             *rbuf            = NULL;
+
+    TESTING_MULTIPART("partial failure of an async batch");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC)) {
+        SKIPPED();
+        HDprintf(
+            "    API functions for basic file, group, or dataset aren't supported with this connector\n");
+        return 0;
+    }
+
+    TESTING_2("test setup");
+
+    if (NULL == (wbuf = HDmalloc(ASYNC_ERR_BENCH_NUM_OPS * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (rbuf = HDmalloc(ASYNC_ERR_BENCH_NUM_OPS * sizeof(int))))
+        TEST_ERROR;
+
+    /* Create dataspaces */
+    if ((fspace_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((mspace_id = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR;
+
+    /* Create event stack */
+    if ((es_id = create_test_event_set()) < 0)
+        TEST_ERROR;
+
+    /*
+     * Create the file, dataset and the group that the injected
+     * operation will try to create again, synchronously
+     */
+    if ((file_id = H5Fcreate(ASYNC_ERR_BENCH_FILE, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((dset_id = H5Dcreate2(file_id, ASYNC_ERR_BENCH_DSET_NAME, H5T_NATIVE_INT, fspace_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((group_id = H5Gcreate2(file_id, ASYNC_ERR_BENCH_GROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                               H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    BEGIN_MULTIPART
+    {
+        PART_BEGIN(batch_without_failure)
+        {
+            TESTING_2("batch of async writes without a failure");
+
+            for (i = 0; i < ASYNC_ERR_BENCH_NUM_OPS; i++)
+                wbuf[i] = (int)i;
+
+            if (async_err_bench_queue(file_id, dset_id, mspace_id, fspace_id, es_id, wbuf, SIZE_MAX,
+                                      &failed_group_id, &failed_op_counter) < 0)
+                PART_TEST_ERROR(batch_without_failure);
+
+            start_time = get_wall_time();
+
+            if (H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+                PART_TEST_ERROR(batch_without_failure);
+
+            baseline_drain_time = get_wall_time() - start_time;
+
+            if (op_failed) {
+                H5_FAILED();
+                HDprintf("    an operation failed in the batch without a failure\n");
+                PART_ERROR(batch_without_failure);
+            }
+
+            if (async_err_bench_count_written(dset_id, wbuf, rbuf, &num_written) < 0)
+                PART_TEST_ERROR(batch_without_failure);
+
+            if (num_written != ASYNC_ERR_BENCH_NUM_OPS) {
+                H5_FAILED();
+                HDprintf("    only %zu of %d writes completed\n", num_written, ASYNC_ERR_BENCH_NUM_OPS);
+                PART_ERROR(batch_without_failure);
+            }
+
+            PASSED();
+
+            HDprintf("    %d writes drained in %.6f s\n", ASYNC_ERR_BENCH_NUM_OPS, baseline_drain_time);
+        }
+        PART_END(batch_without_failure);
+
+        PART_BEGIN(batch_with_failure)
+        {
+            TESTING_2("batch of async writes with a failure in the middle");
+
+            for (i = 0; i < ASYNC_ERR_BENCH_NUM_OPS; i++)
+                wbuf[i] = (int)i + ASYNC_ERR_BENCH_NUM_OPS;
+
+            if (async_err_bench_queue(file_id, dset_id, mspace_id, fspace_id, es_id, wbuf,
+                                      ASYNC_ERR_BENCH_NUM_OPS / 2, &failed_group_id, &failed_op_counter) < 0)
+                PART_TEST_ERROR(batch_with_failure);
+
+            if (failed_group_id < 0) {
+                SKIPPED();
+                HDprintf("    the connector failed the injected operation before queueing it\n");
+                PART_EMPTY(batch_with_failure);
+            }
+
+            /*
+             * The failed operation must not stall the event set; once the
+             * wait returns, every operation has either completed or been
+             * canceled
+             */
+            start_time = get_wall_time();
+
+            H5E_BEGIN_TRY
+            {
+                if (H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+                    num_in_progress = SIZE_MAX;
+            }
+            H5E_END_TRY;
+
+            failed_drain_time = get_wall_time() - start_time;
+
+            H5E_BEGIN_TRY
+            {
+                H5Gclose(failed_group_id);
+            }
+            H5E_END_TRY;
+            failed_group_id = H5I_INVALID_HID;
+
+            if (num_in_progress != 0) {
+                H5_FAILED();
+                HDprintf("    operations were still in progress after waiting on the failed batch\n");
+                PART_ERROR(batch_with_failure);
+            }
+
+            if (!op_failed) {
+                H5_FAILED();
+                HDprintf("    H5ESwait didn't report the injected failure\n");
+                PART_ERROR(batch_with_failure);
+            }
+
+            if (H5ESget_err_status(es_id, &err_occurred) < 0)
+                PART_TEST_ERROR(batch_with_failure);
+
+            if (!err_occurred) {
+                H5_FAILED();
+                HDprintf("    H5ESget_err_status didn't report the injected failure\n");
+                PART_ERROR(batch_with_failure);
+            }
+
+            if (H5ESget_err_count(es_id, &num_err) < 0)
+                PART_TEST_ERROR(batch_with_failure);
+
+            if (num_err < 1) {
+                H5_FAILED();
+                HDprintf("    H5ESget_err_count reported no failed operations\n");
+                PART_ERROR(batch_with_failure);
+            }
+
+            /* The injected operation should be the first failure */
+            if (H5ESget_err_info(es_id, 1, &err_info, &num_cleared) < 0)
+                PART_TEST_ERROR(batch_with_failure);
+
+            if (num_cleared != 1) {
+                H5_FAILED();
+                HDprintf("    H5ESget_err_info retrieved %zu failed operations instead of 1\n", num_cleared);
+                PART_ERROR(batch_with_failure);
+            }
+
+            if (!err_info.api_name || HDstrcmp(err_info.api_name, "H5Gcreate_async") != 0 ||
+                err_info.op_ins_count != failed_op_counter) {
+                H5_FAILED();
+                HDprintf("    first failed operation was %s (operation %llu) instead of H5Gcreate_async "
+                         "(operation %llu)\n",
+                         err_info.api_name ? err_info.api_name : "unknown",
+                         (unsigned long long)err_info.op_ins_count, (unsigned long long)failed_op_counter);
+                H5ESfree_err_info(1, &err_info);
+                PART_ERROR(batch_with_failure);
+            }
+
+            if (!err_info.app_func_name || HDstrcmp(err_info.app_func_name, "async_err_bench_queue") != 0) {
+                H5_FAILED();
+                HDprintf("    failed operation was attributed to %s instead of async_err_bench_queue\n",
+                         err_info.app_func_name ? err_info.app_func_name : "unknown");
+                H5ESfree_err_info(1, &err_info);
+                PART_ERROR(batch_with_failure);
+            }
+
+            if (H5ESfree_err_info(1, &err_info) < 0)
+                PART_TEST_ERROR(batch_with_failure);
+
+            /* Retrieving the error information removes it from the event set */
+            if (H5ESget_err_count(es_id, &num_cleared) < 0)
+                PART_TEST_ERROR(batch_with_failure);
+
+            if (num_cleared != num_err - 1) {
+                H5_FAILED();
+                HDprintf("    event set had %zu failed operations after retrieving 1 of %zu\n", num_cleared,
+                         num_err);
+                PART_ERROR(batch_with_failure);
+            }
+
+            if (async_err_bench_count_written(dset_id, wbuf, rbuf, &num_written) < 0)
+                PART_TEST_ERROR(batch_with_failure);
+
+            PASSED();
+
+            HDprintf("    %zu failed operation(s); %zu writes completed and %zu were canceled\n", num_err,
+                     num_written, ASYNC_ERR_BENCH_NUM_OPS - num_written);
+            HDprintf("    drained in %.6f s (%.2fx the batch without a failure)\n", failed_drain_time,
+                     (baseline_drain_time > 0.0) ? failed_drain_time / baseline_drain_time : 0.0);
+        }
+        PART_END(batch_with_failure);
+
+        /* Clear any error information left over for the next part */
+        H5E_BEGIN_TRY
+        {
+            H5Gclose(failed_group_id);
+            H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed);
+        }
+        H5E_END_TRY;
+        failed_group_id = H5I_INVALID_HID;
+
+        if (H5ESget_err_count(es_id, &num_err) >= 0 && num_err > 0 &&
+            NULL != (remaining_err_info = HDcalloc(num_err, sizeof(H5ES_err_info_t)))) {
+            if (H5ESget_err_info(es_id, num_err, remaining_err_info, &num_cleared) >= 0)
+                H5ESfree_err_info(num_cleared, remaining_err_info);
+            HDfree(remaining_err_info);
+            remaining_err_info = NULL;
+        }
+
+        PART_BEGIN(batch_after_failure)
+        {
+            TESTING_2("batch of async writes after a failure");
+
+            for (i = 0; i < ASYNC_ERR_BENCH_NUM_OPS; i++)
+                wbuf[i] = (int)i + 2 * ASYNC_ERR_BENCH_NUM_OPS;
+
+            if (async_err_bench_queue(file_id, dset_id, mspace_id, fspace_id, es_id, wbuf, SIZE_MAX,
+                                      &failed_group_id, &failed_op_counter) < 0)
+                PART_TEST_ERROR(batch_after_failure);
+
+            if (H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+                PART_TEST_ERROR(batch_after_failure);
+
+            if (op_failed) {
+                H5_FAILED();
+                HDprintf("    an operation failed in the batch after the failure\n");
+                PART_ERROR(batch_after_failure);
+            }
+
+            if (async_err_bench_count_written(dset_id, wbuf, rbuf, &num_written) < 0)
+                PART_TEST_ERROR(batch_after_failure);
+
+            if (num_written != ASYNC_ERR_BENCH_NUM_OPS) {
+                H5_FAILED();
+                HDprintf("    only %zu of %d writes completed\n", num_written, ASYNC_ERR_BENCH_NUM_OPS);
+                PART_ERROR(batch_after_failure);
+            }
+
+            PASSED();
+        }
+        PART_END(batch_after_failure);
+    }
+    END_MULTIPART;
+
+    TESTING_2("test cleanup");
+
+    H5E_BEGIN_TRY
+    {
+        H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed);
+    }
+    H5E_END_TRY;
+
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR;
+    if (H5ESclose(es_id) < 0)
+        TEST_ERROR;
+
+    HDfree(rbuf);
+    HDfree(wbuf);
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Gclose(failed_group_id);
+        H5Gclose(group_id);
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+        H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed);
+        H5ESclose(es_id);
+    }
+    H5E_END_TRY;
+
+    HDfree(rbuf);
+    HDfree(wbuf);
+
+    return 1;
+} /* end test_event_set_partial_failure() */
+
+/*
+ * Queues ASYNC_ERR_BENCH_NUM_OPS single-element writes of buf to the
+ * dataset. If fail_at is less than the number of writes, an attempt
+ * to create a group that already exists is queued before write
+ * fail_at, and the ID it returns and the event set's operation
+ * counter before it was queued are returned. If the connector fails
+ * the group creation immediately, *failed_group_id is negative.
+ */
+static int
+async_err_bench_queue(hid_t file_id, hid_t dset_id, hid_t mspace_id, hid_t fspace_id, hid_t es_id,
+                      const int *buf, size_t fail_at, hid_t *failed_group_id, uint64_t *failed_op_counter)
+{
+    hsize_t start[1];
+    hsize_t count[1] = {1};
+    size_t  i;
+
+    *failed_group_id   = H5I_INVALID_HID;
+    *failed_op_counter = 0;
+
+    for (i = 0; i < ASYNC_ERR_BENCH_NUM_OPS; i++) {
+        if (i == fail_at) {
+            if (H5ESget_op_counter(es_id, failed_op_counter) < 0)
+                return -1;
+
+            H5E_BEGIN_TRY
+            {
+                *failed_group_id = H5Gcreate_async(file_id, ASYNC_ERR_BENCH_GROUP_NAME, H5P_DEFAULT,
+                                                   H5P_DEFAULT, H5P_DEFAULT, es_id);
+            }
+            H5E_END_TRY;
+        }
+
+        start[0] = i;
+
+        if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            return -1;
+
+        if (H5Dwrite_async(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT, &buf[i], es_id) < 0)
+            return -1;
+    }
+
+    return 0;
+} /* end async_err_bench_queue() */
+
+/*
+ * Reads the dataset back and counts how many elements hold the value
+ * the last batch of writes wrote to them.
+ */
+static int
+async_err_bench_count_written(hid_t dset_id, const int *wbuf, int *rbuf, size_t *num_written)
+{
+    size_t i;
+
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        return -1;
+
+    for (i = 0, *num_written = 0; i < ASYNC_ERR_BENCH_NUM_OPS; i++)
+        if (rbuf[i] == wbuf[i])
+            (*num_written)++;
+
+    return 0;
+} /* end async_err_bench_count_written() */
+
+/*
+ * A benchmark emulating the checkpoint loop of a simulation. Each
+ * step fills a buffer with the step's data, computes for a while,
+ * then writes the buffer as a new dataset in one of several files,
+ * round-robin. With the async API, two buffers are used in turn, so
+ * each step fills one buffer while the write of the other is still
+ * in flight, and each buffer has its own event set so that a step
+ * only waits for the write issued from its buffer two steps earlier.
+ * The files are closed with H5Fclose_async at the end. The rate of
+ * steps achieved is compared with the same loop using the synchronous
+ * API, and the memory used by the buffers and the peak growth in
+ * resident memory during the loop are reported.
+ */
+static int
+test_async_checkpoint_benchmark(void)
+{
+    size_t  peak_mem_growth;
+    size_t  i;
+    double  compute_iters_per_sec;
+    double  sync_io_time = 0.0;
+    double  sync_elapsed = 0.0, async_elapsed;
+    double  data_size    = (double)ASYNC_CKPT_BENCH_STEP_ELEMS * sizeof(double) * ASYNC_CKPT_BENCH_NUM_STEPS;
+    double *bufs[2]      = {NULL, NULL};
+    double *rbuf         = NULL;
+    double *expected_buf = NULL;
+
+    TESTING_MULTIPART("async checkpoint pipeline benchmark");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file or dataset aren't supported with this connector\n");
+        return 0;
+    }
+
+    TESTING_2("test setup");
+
+    for (i = 0; i < 2; i++)
+        if (NULL == (bufs[i] = HDcalloc(ASYNC_CKPT_BENCH_STEP_ELEMS, sizeof(double))))
+            TEST_ERROR;
+    if (NULL == (rbuf = HDmalloc(ASYNC_CKPT_BENCH_STEP_ELEMS * sizeof(double))))
+        TEST_ERROR;
+    if (NULL == (expected_buf = HDmalloc(ASYNC_CKPT_BENCH_STEP_ELEMS * sizeof(double))))
+        TEST_ERROR;
+
+    compute_iters_per_sec = calibrate_compute_kernel();
+
+    PASSED();
+
+    BEGIN_MULTIPART
+    {
+        PART_BEGIN(checkpoint_sync)
+        {
+            TESTING_2("checkpoint loop with synchronous I/O");
+
+            if (async_ckpt_bench_run(FALSE, bufs, compute_iters_per_sec, &sync_io_time, &sync_elapsed,
+                                     &peak_mem_growth) < 0)
+                PART_TEST_ERROR(checkpoint_sync);
+
+            if (async_ckpt_bench_verify(rbuf, expected_buf) < 0)
+                PART_TEST_ERROR(checkpoint_sync);
+
+            PASSED();
+
+            HDprintf("    %d steps in %.6f s: %.2f steps/s, %.2f MiB/s (%.6f s of I/O)\n",
+                     ASYNC_CKPT_BENCH_NUM_STEPS, sync_elapsed,
+                     (sync_elapsed > 0.0) ? ASYNC_CKPT_BENCH_NUM_STEPS / sync_elapsed : 0.0,
+                     (sync_elapsed > 0.0) ? data_size / (1024.0 * 1024.0) / sync_elapsed : 0.0, sync_io_time);
+        }
+        PART_END(checkpoint_sync);
+
+        PART_BEGIN(checkpoint_async)
+        {
+            const char *compute_time_str = HDgetenv(HDF5_API_TEST_ASYNC_COMPUTE_TIME);
+
+            TESTING_2("double-buffered checkpoint loop with async I/O");
+
+            /* Unless a compute time was given, the async loop computes for as long as the sync I/O took */
+            if (sync_io_time <= 0.0 && !(compute_time_str && HDatof(compute_time_str) > 0.0)) {
+                SKIPPED();
+                HDprintf("    no synchronous I/O time to match compute time to; set %s to run this part\n",
+                         HDF5_API_TEST_ASYNC_COMPUTE_TIME);
+                PART_EMPTY(checkpoint_async);
+            }
+
+            if (async_ckpt_bench_run(TRUE, bufs, compute_iters_per_sec, &sync_io_time, &async_elapsed,
+                                     &peak_mem_growth) < 0)
+                PART_TEST_ERROR(checkpoint_async);
+
+            if (async_ckpt_bench_verify(rbuf, expected_buf) < 0)
+                PART_TEST_ERROR(checkpoint_async);
+
+            PASSED();
+
+            HDprintf("    %d steps in %.6f s: %.2f steps/s, %.2f MiB/s (%.2fx synchronous)\n",
+                     ASYNC_CKPT_BENCH_NUM_STEPS, async_elapsed,
+                     (async_elapsed > 0.0) ? ASYNC_CKPT_BENCH_NUM_STEPS / async_elapsed : 0.0,
+                     (async_elapsed > 0.0) ? data_size / (1024.0 * 1024.0) / async_elapsed : 0.0,
+                     (async_elapsed > 0.0) ? sync_elapsed / async_elapsed : 0.0);
+            HDprintf("    buffer memory: %.2f MiB, peak resident memory growth: %.2f MiB\n",
+                     2.0 * ASYNC_CKPT_BENCH_STEP_ELEMS * sizeof(double) / (1024.0 * 1024.0),
+                     (double)peak_mem_growth / (1024.0 * 1024.0));
+        }
+        PART_END(checkpoint_async);
+    }
+    END_MULTIPART;
+
+    TESTING_2("test cleanup");
+
+    HDfree(expected_buf);
+    HDfree(rbuf);
+    HDfree(bufs[1]);
+    HDfree(bufs[0]);
+
+    PASSED();
+
+    return 0;
+
+error:
+    HDfree(expected_buf);
+    HDfree(rbuf);
+    HDfree(bufs[1]);
+    HDfree(bufs[0]);
+
+    return 1;
+} /* end test_async_checkpoint_benchmark() */
+
+/*
+ * Fills a checkpoint buffer with the data for a step. Every value
+ * written over the whole run is distinct, so data written from the
+ * wrong buffer or at the wrong step is caught by verification.
+ */
+static void
+async_ckpt_bench_fill(double *buf, int step)
+{
+    size_t i;
+
+    for (i = 0; i < ASYNC_CKPT_BENCH_STEP_ELEMS; i++)
+        buf[i] = (double)step * ASYNC_CKPT_BENCH_STEP_ELEMS + (double)i;
+} /* end async_ckpt_bench_fill() */
+
+/*
+ * Runs the checkpoint loop, returning the time it took from creating
+ * the files until they were closed and the peak growth in resident
+ * memory while it ran. When run synchronously, the time spent in I/O
+ * is returned in *sync_io_time, and each step computes for as long
+ * as its I/O took, unless a compute time was given. When run
+ * asynchronously, each step computes for the average time a step's
+ * I/O took synchronously, so both loops do the same computation.
+ */
+static int
+async_ckpt_bench_run(hbool_t use_async, double *bufs[2], double compute_iters_per_sec, double *sync_io_time,
+                     double *elapsed, size_t *peak_mem_growth)
+{
+    const char *compute_time_str = HDgetenv(HDF5_API_TEST_ASYNC_COMPUTE_TIME);
+    hsize_t     dims[1]          = {ASYNC_CKPT_BENCH_STEP_ELEMS};
+    size_t      num_in_progress;
+    size_t      mem_before, mem;
+    double      start_time, step_io_time;
+    double      compute_time;
+    hbool_t     op_failed;
+    char        file_name[64];
+    char        dset_name[64];
+    hid_t       file_ids[ASYNC_CKPT_BENCH_NUM_FILES];
+    hid_t       es_ids[2] = {H5I_INVALID_HID, H5I_INVALID_HID};
+    hid_t       dset_id   = H5I_INVALID_HID;
+    hid_t       space_id  = H5I_INVALID_HID;
+    herr_t      status;
+    int         i;
+    int         ret_value = -1;
+
+    for (i = 0; i < ASYNC_CKPT_BENCH_NUM_FILES; i++)
+        file_ids[i] = H5I_INVALID_HID;
+
+    *elapsed         = 0.0;
+    *peak_mem_growth = 0;
+    if (!use_async)
+        *sync_io_time = 0.0;
+
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        goto done;
+
+    /* One event set per buffer, so a step only waits for the write from its own buffer */
+    if (use_async)
+        for (i = 0; i < 2; i++)
+            if ((es_ids[i] = create_test_event_set()) < 0)
+                goto done;
+
+    mem_before = get_resident_memory();
+    start_time = get_wall_time();
+
+    for (i = 0; i < ASYNC_CKPT_BENCH_NUM_FILES; i++) {
+        HDsnprintf(file_name, sizeof(file_name), ASYNC_CKPT_BENCH_FILE_PRINTF, i);
+
+        if (use_async)
+            file_ids[i] = H5Fcreate_async(file_name, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT, es_ids[0]);
+        else
+            file_ids[i] = H5Fcreate(file_name, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+
+        if (file_ids[i] < 0)
+            goto done;
+    }
+
+    for (i = 0; i < ASYNC_CKPT_BENCH_NUM_STEPS; i++) {
+        double *buf   = bufs[i % 2];
+        hid_t   es_id = es_ids[i % 2];
+
+        /* Wait for the write issued from this buffer two steps ago before refilling it */
+        if (use_async) {
+            if (H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+                goto done;
+            if (op_failed) {
+                HDprintf("    async checkpoint write failed\n");
+                goto done;
+            }
+        }
+
+        async_ckpt_bench_fill(buf, i);
+
+        HDsnprintf(dset_name, sizeof(dset_name), ASYNC_CKPT_BENCH_DSET_NAME_PRINTF, i);
+
+        step_io_time = get_wall_time();
+
+        if (use_async) {
+            if ((dset_id = H5Dcreate_async(file_ids[i % ASYNC_CKPT_BENCH_NUM_FILES], dset_name,
+                                           H5T_NATIVE_DOUBLE, space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT,
+                                           es_id)) < 0)
+                goto done;
+
+            status = H5Dwrite_async(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf, es_id);
+            if (H5Dclose_async(dset_id, es_id) < 0)
+                status = -1;
+        }
+        else {
+            if ((dset_id = H5Dcreate2(file_ids[i % ASYNC_CKPT_BENCH_NUM_FILES], dset_name, H5T_NATIVE_DOUBLE,
+                                      space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+                goto done;
+
+            status = H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+            if (H5Dclose(dset_id) < 0)
+                status = -1;
+        }
+
+        dset_id = H5I_INVALID_HID;
+
+        if (status < 0) {
+            HDprintf("    %s checkpoint write failed\n", use_async ? "async" : "synchronous");
+            goto done;
+        }
+
+        step_io_time = get_wall_time() - step_io_time;
+        if (!use_async)
+            *sync_io_time += step_io_time;
+
+        /* Compute until the next checkpoint */
+        if (compute_time_str && HDatof(compute_time_str) > 0.0)
+            compute_time = HDatof(compute_time_str);
+        else if (use_async)
+            compute_time = *sync_io_time / ASYNC_CKPT_BENCH_NUM_STEPS;
+        else
+            compute_time = step_io_time;
+
+        run_compute_kernel((size_t)(compute_time * compute_iters_per_sec));
+
+        if ((mem = get_resident_memory()) > mem_before && mem - mem_before > *peak_mem_growth)
+            *peak_mem_growth = mem - mem_before;
+    }
+
+    for (i = 0; i < ASYNC_CKPT_BENCH_NUM_FILES; i++) {
+        if (use_async)
+            status = H5Fclose_async(file_ids[i], es_ids[ASYNC_CKPT_BENCH_NUM_STEPS % 2]);
+        else
+            status = H5Fclose(file_ids[i]);
+
+        if (status < 0)
+            goto done;
+        file_ids[i] = H5I_INVALID_HID;
+    }
+
+    if (use_async)
+        for (i = 0; i < 2; i++) {
+            if (H5ESwait(es_ids[i], VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+                goto done;
+            if (op_failed) {
+                HDprintf("    async checkpoint write or file close failed\n");
+                goto done;
+            }
+        }
+
+    *elapsed = get_wall_time() - start_time;
+
+    ret_value = 0;
+
+done:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        for (i = 0; i < ASYNC_CKPT_BENCH_NUM_FILES; i++)
+            H5Fclose(file_ids[i]);
+        for (i = 0; i < 2; i++) {
+            H5ESwait(es_ids[i], VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed);
+            H5ESclose(es_ids[i]);
+        }
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+
+    return ret_value;
+} /* end async_ckpt_bench_run() */
+
+/*
+ * Reads back every step's dataset and checks that it holds the data
+ * for that step.
+ */
+static int
+async_ckpt_bench_verify(double *rbuf, double *expected)
+{
+    size_t j;
+    char   file_name[64];
+    char   dset_name[64];
+    hid_t  file_id = H5I_INVALID_HID;
+    hid_t  dset_id = H5I_INVALID_HID;
+    int    i;
+
+    for (i = 0; i < ASYNC_CKPT_BENCH_NUM_STEPS; i++) {
+        HDsnprintf(file_name, sizeof(file_name), ASYNC_CKPT_BENCH_FILE_PRINTF,
+                   i % ASYNC_CKPT_BENCH_NUM_FILES);
+        HDsnprintf(dset_name, sizeof(dset_name), ASYNC_CKPT_BENCH_DSET_NAME_PRINTF, i);
+
+        if ((file_id = H5Fopen(file_name, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0)
+            goto error;
+        if ((dset_id = H5Dopen2(file_id, dset_name, H5P_DEFAULT)) < 0)
+            goto error;
+        if (H5Dread(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            goto error;
+        if (H5Dclose(dset_id) < 0)
+            goto error;
+        dset_id = H5I_INVALID_HID;
+        if (H5Fclose(file_id) < 0)
+            goto error;
+        file_id = H5I_INVALID_HID;
+
+        async_ckpt_bench_fill(expected, i);
+
+        for (j = 0; j < ASYNC_CKPT_BENCH_STEP_ELEMS; j++)
+            if (rbuf[j] != expected[j]) {
+                HDprintf("    data verification failed for step %d at index %zu\n", i, j);
+                goto error;
+            }
+    }
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    return -1;
+} /* end async_ckpt_bench_verify() */
+
+/*
+ * A benchmark to measure how much pipelining metadata operations with
+ * the async API gains over performing them one at a time. Thousands of
+ * group creates, hard link creates, attribute creates and writes, and
+ * H5Oexists_by_name lookups are performed with the synchronous API in
+ * one container group and with the async API in another, draining the
+ * event set after each phase. The throughput of each phase is compared
+ * and the results of both runs are verified.
+ */
+static int
+test_async_metadata_pipeline_benchmark(void)
+{
+    size_t   num_in_progress;
+    size_t   i;
+    hbool_t  op_failed;
+    double   sync_times[MD_BENCH_NUM_PHASES];
+    double   async_times[MD_BENCH_NUM_PHASES];
+    hid_t    file_id   = H5I_INVALID_HID;
+    hid_t    es_id     = H5I_INVALID_HID;
+    int     *attr_vals = NULL;
+    hbool_t *exists    = NULL;
+
+    TESTING_MULTIPART("async metadata operation pipelining benchmark");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_LINK_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_HARD_LINKS) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_ATTR_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_OBJECT_BASIC)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file, group, link, hard link, attribute, or object aren't "
+                 "supported with this connector\n");
+        return 0;
+    }
+
+    TESTING_2("test setup");
+
+    if (NULL == (attr_vals = HDmalloc(ASYNC_MD_BENCH_NUM_OPS * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (exists = HDmalloc(ASYNC_MD_BENCH_NUM_OPS * sizeof(hbool_t))))
+        TEST_ERROR;
+
+    /* Create event stack */
+    if ((es_id = create_test_event_set()) < 0)
+        TEST_ERROR;
+
+    if ((file_id = H5Fcreate(ASYNC_MD_BENCH_FILE, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    BEGIN_MULTIPART
+    {
+        PART_BEGIN(md_sync)
+        {
+            TESTING_2("synchronous metadata operations");
+
+            for (i = 0; i < ASYNC_MD_BENCH_NUM_OPS; i++)
+                attr_vals[i] = (int)i;
+            HDmemset(exists, 0, ASYNC_MD_BENCH_NUM_OPS * sizeof(hbool_t));
+
+            if (async_md_bench_run(file_id, ASYNC_MD_BENCH_SYNC_GROUP_NAME, H5I_INVALID_HID, attr_vals,
+                                   exists, sync_times) < 0)
+                PART_TEST_ERROR(md_sync);
+
+            if (async_md_bench_verify(file_id, ASYNC_MD_BENCH_SYNC_GROUP_NAME, attr_vals, exists) < 0)
+                PART_TEST_ERROR(md_sync);
+
+            PASSED();
+
+            for (i = 0; i < MD_BENCH_NUM_PHASES; i++)
+                HDprintf("    %-23s %.6f s (%.0f ops/s)\n", md_bench_phase_names[i], sync_times[i],
+                         (sync_times[i] > 0.0) ? ASYNC_MD_BENCH_NUM_OPS / sync_times[i] : 0.0);
+        }
+        PART_END(md_sync);
+
+        PART_BEGIN(md_async)
+        {
+            TESTING_2("pipelined async metadata operations");
+
+            /* Use different values from the synchronous run, so stale results can't pass verification */
+            for (i = 0; i < ASYNC_MD_BENCH_NUM_OPS; i++)
+                attr_vals[i] = (int)(ASYNC_MD_BENCH_NUM_OPS + i);
+            HDmemset(exists, 0, ASYNC_MD_BENCH_NUM_OPS * sizeof(hbool_t));
+
+            if (async_md_bench_run(file_id, ASYNC_MD_BENCH_ASYNC_GROUP_NAME, es_id, attr_vals, exists,
+                                   async_times) < 0)
+                PART_TEST_ERROR(md_async);
+
+            if (async_md_bench_verify(file_id, ASYNC_MD_BENCH_ASYNC_GROUP_NAME, attr_vals, exists) < 0)
+                PART_TEST_ERROR(md_async);
+
+            PASSED();
+
+            for (i = 0; i < MD_BENCH_NUM_PHASES; i++)
+                HDprintf("    %-23s %.6f s (%.0f ops/s, %.2fx synchronous)\n", md_bench_phase_names[i],
+                         async_times[i],
+                         (async_times[i] > 0.0) ? ASYNC_MD_BENCH_NUM_OPS / async_times[i] : 0.0,
+                         (async_times[i] > 0.0) ? sync_times[i] / async_times[i] : 0.0);
+        }
+        PART_END(md_async);
+    }
+    END_MULTIPART;
+
+    TESTING_2("test cleanup");
+
+    if (H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+        TEST_ERROR;
+    if (op_failed)
+        TEST_ERROR;
+
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+    if (H5ESclose(es_id) < 0)
+        TEST_ERROR;
+
+    HDfree(exists);
+    HDfree(attr_vals);
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(file_id);
+        H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed);
+        H5ESclose(es_id);
+    }
+    H5E_END_TRY;
+
+    HDfree(exists);
+    HDfree(attr_vals);
+
+    return 1;
+} /* end test_async_metadata_pipeline_benchmark() */
+
+/*
+ * Runs each phase of the metadata benchmark in a new container group,
+ * returning the time each phase took. If es_id is a valid event set,
+ * the async API is used and each phase's time includes draining the
+ * event set; otherwise the synchronous API is used.
+ */
+static int
+async_md_bench_run(hid_t file_id, const char *container_name, hid_t es_id, int *attr_vals, hbool_t *exists,
+                   double *phase_times)
+{
+    hbool_t use_async = (es_id >= 0);
+    size_t  num_in_progress;
+    size_t  i;
+    hbool_t op_failed;
+    htri_t  obj_exists;
+    double  start_time;
+    char    group_name[64];
+    char    link_name[64];
+    hid_t   container_id = H5I_INVALID_HID;
+    hid_t   group_id     = H5I_INVALID_HID;
+    hid_t   attr_id      = H5I_INVALID_HID;
+    hid_t   space_id     = H5I_INVALID_HID;
+    herr_t  status;
+    int     phase;
+    int     ret_value = -1;
+
+    for (phase = 0; phase < MD_BENCH_NUM_PHASES; phase++)
+        phase_times[phase] = 0.0;
+
+    if ((space_id = H5Screate(H5S_SCALAR)) < 0)
+        goto done;
+
+    if ((container_id = H5Gcreate2(file_id, container_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto done;
+
+    for (phase = 0; phase < MD_BENCH_NUM_PHASES; phase++) {
+        start_time = get_wall_time();
+
+        for (i = 0; i < ASYNC_MD_BENCH_NUM_OPS; i++) {
+            HDsnprintf(group_name, sizeof(group_name), "group_%zu", i);
+            HDsnprintf(link_name, sizeof(link_name), "link_%zu", i);
+
+            switch (phase) {
+                case MD_BENCH_PHASE_GROUP_CREATE:
+                    if (use_async) {
+                        if ((group_id = H5Gcreate_async(container_id, group_name, H5P_DEFAULT, H5P_DEFAULT,
+                                                        H5P_DEFAULT, es_id)) < 0)
+                            goto done;
+                        status = H5Gclose_async(group_id, es_id);
+                    }
+                    else {
+                        if ((group_id = H5Gcreate2(container_id, group_name, H5P_DEFAULT, H5P_DEFAULT,
+                                                   H5P_DEFAULT)) < 0)
+                            goto done;
+                        status = H5Gclose(group_id);
+                    }
+                    group_id = H5I_INVALID_HID;
+                    break;
+
+                case MD_BENCH_PHASE_LINK_CREATE:
+                    if (use_async)
+                        status = H5Lcreate_hard_async(container_id, group_name, container_id, link_name,
+                                                      H5P_DEFAULT, H5P_DEFAULT, es_id);
+                    else
+                        status = H5Lcreate_hard(container_id, group_name, container_id, link_name,
+                                                H5P_DEFAULT, H5P_DEFAULT);
+                    break;
+
+                case MD_BENCH_PHASE_ATTR_WRITE:
+                    if (use_async) {
+                        if ((attr_id = H5Acreate_by_name_async(
+                                 container_id, group_name, ASYNC_MD_BENCH_ATTR_NAME, H5T_NATIVE_INT, space_id,
+                                 H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT, es_id)) < 0)
+                            goto done;
+                        status = H5Awrite_async(attr_id, H5T_NATIVE_INT, &attr_vals[i], es_id);
+                        if (H5Aclose_async(attr_id, es_id) < 0)
+                            status = -1;
+                    }
+                    else {
+                        if ((attr_id = H5Acreate_by_name(container_id, group_name, ASYNC_MD_BENCH_ATTR_NAME,
+                                                         H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT,
+                                                         H5P_DEFAULT)) < 0)
+                            goto done;
+                        status = H5Awrite(attr_id, H5T_NATIVE_INT, &attr_vals[i]);
+                        if (H5Aclose(attr_id) < 0)
+                            status = -1;
+                    }
+                    attr_id = H5I_INVALID_HID;
+                    break;
+
+                case MD_BENCH_PHASE_OBJ_EXISTS:
+                    if (use_async)
+                        status = H5Oexists_by_name_async(container_id, link_name, &exists[i], H5P_DEFAULT,
+                                                         es_id);
+                    else {
+                        obj_exists = H5Oexists_by_name(container_id, link_name, H5P_DEFAULT);
+                        exists[i]  = (obj_exists > 0);
+                        status     = (obj_exists < 0) ? -1 : 0;
+                    }
+                    break;
+
+                default:
+                    status = -1;
+                    break;
+            }
+
+            if (status < 0) {
+                HDprintf("    %s %s failed for %s\n", use_async ? "async" : "synchronous",
+                         md_bench_phase_names[phase], group_name);
+                goto done;
+            }
+        }
+
+        if (use_async) {
+            if (H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+                goto done;
+            if (op_failed) {
+                HDprintf("    async %s failed\n", md_bench_phase_names[phase]);
+                goto done;
+            }
+        }
+
+        phase_times[phase] = get_wall_time() - start_time;
+    }
+
+    ret_value = 0;
+
+done:
+    H5E_BEGIN_TRY
+    {
+        H5Aclose(attr_id);
+        H5Gclose(group_id);
+        if (use_async)
+            H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed);
+        H5Gclose(container_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+
+    return ret_value;
+} /* end async_md_bench_run() */
+
+/*
+ * Verifies the objects created by a run of the metadata benchmark:
+ * the container should hold a group and a hard link to it for each
+ * operation, each group should have an attribute holding the value
+ * written for it and every lookup should have found its object.
+ */
+static int
+async_md_bench_verify(hid_t file_id, const char *container_name, const int *attr_vals, const hbool_t *exists)
+{
+    H5G_info_t group_info;
+    size_t     i;
+    char       group_name[64];
+    hid_t      container_id = H5I_INVALID_HID;
+    hid_t      attr_id      = H5I_INVALID_HID;
+    int        attr_val;
+
+    if ((container_id = H5Gopen2(file_id, container_name, H5P_DEFAULT)) < 0)
+        goto error;
+
+    if (H5Gget_info(container_id, &group_info) < 0)
+        goto error;
+
+    if (group_info.nlinks != 2 * ASYNC_MD_BENCH_NUM_OPS) {
+        HDprintf("    container held %llu links instead of %d\n", (unsigned long long)group_info.nlinks,
+                 2 * ASYNC_MD_BENCH_NUM_OPS);
+        goto error;
+    }
+
+    for (i = 0; i < ASYNC_MD_BENCH_NUM_OPS; i++) {
+        if (!exists[i]) {
+            HDprintf("    H5Oexists_by_name didn't find link_%zu\n", i);
+            goto error;
+        }
+
+        HDsnprintf(group_name, sizeof(group_name), "group_%zu", i);
+
+        if ((attr_id = H5Aopen_by_name(container_id, group_name, ASYNC_MD_BENCH_ATTR_NAME, H5P_DEFAULT,
+                                       H5P_DEFAULT)) < 0)
+            goto error;
+        if (H5Aread(attr_id, H5T_NATIVE_INT, &attr_val) < 0)
+            goto error;
+        if (H5Aclose(attr_id) < 0)
+            goto error;
+        attr_id = H5I_INVALID_HID;
+
+        if (attr_val != attr_vals[i]) {
+            HDprintf("    attribute of %s was %d instead of %d\n", group_name, attr_val, attr_vals[i]);
+            goto error;
+        }
+    }
+
+    if (H5Gclose(container_id) < 0)
+        goto error;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Aclose(attr_id);
+        H5Gclose(container_id);
+    }
+    H5E_END_TRY;
+
+    return -1;
+} /* end async_md_bench_verify() */
+
+/*
+ * A benchmark streaming appends to a dataset, as a data acquisition
+ * system would. Each append extends the dataset by one record with
+ * H5Dset_extent_async and writes the record with H5Dwrite_async, and
+ * all of the appends are queued without waiting in between, so the
+ * connector must keep every write ordered after the extend that makes
+ * room for it. The rate at which appends are queued is measured over
+ * windows of the run to catch a slowdown as the queue grows, along
+ * with the overall append rate once the event set has drained and the
+ * growth in resident memory while the appends were pending. The final
+ * extent and contents of the dataset are verified.
+ */
+static int
+test_async_set_extent_streaming_benchmark(void)
+{
+    hsize_t dims[1]       = {0};
+    hsize_t max_dims[1]   = {H5S_UNLIMITED};
+    hsize_t chunk_dims[1] = {ASYNC_STREAM_BENCH_CHUNK_SIZE};
+    hsize_t start[1];
+    hsize_t count[1]           = {ASYNC_STREAM_BENCH_RECORD_SIZE};
+    hsize_t total_elems        = (hsize_t)ASYNC_STREAM_BENCH_NUM_APPENDS * ASYNC_STREAM_BENCH_RECORD_SIZE;
+    size_t  appends_per_window = ASYNC_STREAM_BENCH_NUM_APPENDS / ASYNC_STREAM_BENCH_NUM_WINDOWS;
+    size_t  num_in_progress;
+    size_t  mem_before, mem_pending, mem_after;
+    size_t  i;
+    hbool_t op_failed;
+    double  window_times[ASYNC_STREAM_BENCH_NUM_WINDOWS] = {0.0};
+    double  start_time, window_start;
+    double  enqueue_time, drain_time;
+    hid_t   file_id   = H5I_INVALID_HID;
+    hid_t   dset_id   = H5I_INVALID_HID;
+    hid_t   fspace_id = H5I_INVALID_HID;
+    hid_t   mspace_id = H5I_INVALID_HID;
+    hid_t   dcpl_id   = H5I_INVALID_HID;
+    hid_t   es_id     = H5I_INVALID_HID;
+    int    *wbuf      = NULL;
+    int    *rbuf      = NULL;
+
+    TESTING("async H5Dset_extent/H5Dwrite streaming benchmark");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_MORE)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file, dataset, or dataset more aren't supported with this "
+                 "connector\n");
+        return 0;
+    }
+
+    /* Each append needs its own slice of the buffer, since none complete until the end */
+    if (NULL == (wbuf = HDmalloc(total_elems * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (rbuf = HDmalloc(total_elems * sizeof(int))))
+        TEST_ERROR;
+
+    for (i = 0; i < total_elems; i++)
+        wbuf[i] = (int)i;
+
+    if ((fspace_id = H5Screate_simple(1, dims, max_dims)) < 0)
+        TEST_ERROR;
+    if ((mspace_id = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR;
+
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 1, chunk_dims) < 0)
+        TEST_ERROR;
+
+    /* Create event stack */
+    if ((es_id = create_test_event_set()) < 0)
+        TEST_ERROR;
+
+    /* Create file and dataset synchronously so their creation isn't part of the timings */
+    if ((file_id = H5Fcreate(ASYNC_STREAM_BENCH_FILE, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((dset_id = H5Dcreate2(file_id, ASYNC_STREAM_BENCH_DSET_NAME, H5T_NATIVE_INT, fspace_id, H5P_DEFAULT,
+                              dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    mem_before   = get_resident_memory();
+    start_time   = get_wall_time();
+    window_start = start_time;
+
+    for (i = 0; i < ASYNC_STREAM_BENCH_NUM_APPENDS; i++) {
+        /* Extend the dataset by one record */
+        start[0] = dims[0];
+        dims[0] += ASYNC_STREAM_BENCH_RECORD_SIZE;
+
+        if (H5Dset_extent_async(dset_id, dims, es_id) < 0)
+            TEST_ERROR;
+
+        /* Write the record into the new space */
+        if (H5Sset_extent_simple(fspace_id, 1, dims, max_dims) < 0)
+            TEST_ERROR;
+        if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR;
+
+        if (H5Dwrite_async(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT, &wbuf[start[0]],
+                           es_id) < 0)
+            TEST_ERROR;
+
+        /* Record how long each window of appends took to queue */
+        if ((i + 1) % appends_per_window == 0 &&
+            (i + 1) / appends_per_window <= ASYNC_STREAM_BENCH_NUM_WINDOWS) {
+            double now = get_wall_time();
+
+            window_times[(i + 1) / appends_per_window - 1] = now - window_start;
+            window_start                                   = now;
+        }
+    }
+
+    enqueue_time = get_wall_time() - start_time;
+    mem_pending  = get_resident_memory();
+
+    if (H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+        TEST_ERROR;
+    if (op_failed)
+        TEST_ERROR;
+
+    drain_time = get_wall_time() - start_time - enqueue_time;
+    mem_after  = get_resident_memory();
+
+    /* Verify the final extent and contents */
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR;
+    if ((fspace_id = H5Dget_space(dset_id)) < 0)
+        TEST_ERROR;
+    if (H5Sget_simple_extent_dims(fspace_id, dims, NULL) < 0)
+        TEST_ERROR;
+
+    if (dims[0] != total_elems) {
+        H5_FAILED();
+        HDprintf("    dataset extent was %llu instead of %llu\n", (unsigned long long)dims[0],
+                 (unsigned long long)total_elems);
+        goto error;
+    }
+
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+
+    for (i = 0; i < total_elems; i++)
+        if (rbuf[i] != wbuf[i]) {
+            H5_FAILED();
+            HDprintf("    data verification failed at index %zu (append %zu)\n", i,
+                     i / ASYNC_STREAM_BENCH_RECORD_SIZE);
+            goto error;
+        }
+
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+    if (H5ESclose(es_id) < 0)
+        TEST_ERROR;
+
+    HDfree(rbuf);
+    HDfree(wbuf);
+
+    PASSED();
+
+    HDprintf("    %d appends of %d elements: queued in %.6f s, drained in %.6f s (%.0f appends/s)\n",
+             ASYNC_STREAM_BENCH_NUM_APPENDS, ASYNC_STREAM_BENCH_RECORD_SIZE, enqueue_time, drain_time,
+             (enqueue_time + drain_time > 0.0)
+                 ? ASYNC_STREAM_BENCH_NUM_APPENDS / (enqueue_time + drain_time)
+                 : 0.0);
+    HDprintf("    queueing rate in the first and last %d%% of appends: %.0f and %.0f appends/s\n",
+             100 / ASYNC_STREAM_BENCH_NUM_WINDOWS,
+             (window_times[0] > 0.0) ? appends_per_window / window_times[0] : 0.0,
+             (window_times[ASYNC_STREAM_BENCH_NUM_WINDOWS - 1] > 0.0)
+                 ? appends_per_window / window_times[ASYNC_STREAM_BENCH_NUM_WINDOWS - 1]
+                 : 0.0);
+    HDprintf("    resident memory growth: %.2f MiB with all appends pending (%.0f bytes per append), "
+             "%.2f MiB after draining\n",
+             (double)(mem_pending - MIN(mem_before, mem_pending)) / (1024.0 * 1024.0),
+             (double)(mem_pending - MIN(mem_before, mem_pending)) / ASYNC_STREAM_BENCH_NUM_APPENDS,
+             (double)(mem_after - MIN(mem_before, mem_after)) / (1024.0 * 1024.0));
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dcpl_id);
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+        H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed);
+        H5ESclose(es_id);
+    }
+    H5E_END_TRY;
+
+    HDfree(rbuf);
+    HDfree(wbuf);
+
+    return 1;
+} /* end test_async_set_extent_streaming_benchmark() */
+
+/*
+ * A benchmark to measure whether the datatype conversion needed by
+ * async dataset I/O is performed on the calling thread, where it
+ * delays the application, or in the background, where it can overlap
+ * with computation. Large buffers are written and read with two
+ * expensive conversions: big-endian 16-bit integers in the file to
+ * native doubles in memory, and a big-endian compound type in the
+ * file to a native compound type with its members in reverse order.
+ * The cost of the conversion is estimated by comparing synchronous
+ * I/O with and without conversion, and compared with the time spent
+ * inside the async I/O call and in H5ESwait after overlapping the
+ * async I/O with computation.
+ */
+typedef struct tconv_bench_cmpd_t {
+    short  c;
+    double b;
+    int    a;
+} tconv_bench_cmpd_t;
+
+static int
+test_async_tconv_benchmark(void)
+{
+    async_tconv_bench_times_t times;
+    tconv_bench_cmpd_t       *cmpd_wbuf = NULL;
+    tconv_bench_cmpd_t       *cmpd_rbuf = NULL;
+    hsize_t                   dims[1]   = {ASYNC_TCONV_BENCH_NUM_ELEMS};
+    size_t                    num_in_progress;
+    size_t                    i;
+    hbool_t                   op_failed;
+    double                    compute_iters_per_sec;
+    double                   *wbuf          = NULL;
+    double                   *rbuf          = NULL;
+    void                     *raw_buf       = NULL;
+    hid_t                     file_id       = H5I_INVALID_HID;
+    hid_t                     int_dset_id   = H5I_INVALID_HID;
+    hid_t                     cmpd_dset_id  = H5I_INVALID_HID;
+    hid_t                     space_id      = H5I_INVALID_HID;
+    hid_t                     cmpd_mtype_id = H5I_INVALID_HID;
+    hid_t                     cmpd_ftype_id = H5I_INVALID_HID;
+    hid_t                     es_id         = H5I_INVALID_HID;
+
+    TESTING_MULTIPART("async dataset I/O type conversion benchmark");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file or dataset aren't supported with this connector\n");
+        return 0;
+    }
+
+    TESTING_2("test setup");
+
+    if (NULL == (wbuf = HDmalloc(ASYNC_TCONV_BENCH_NUM_ELEMS * sizeof(double))))
+        TEST_ERROR;
+    if (NULL == (rbuf = HDmalloc(ASYNC_TCONV_BENCH_NUM_ELEMS * sizeof(double))))
+        TEST_ERROR;
+    if (NULL == (cmpd_wbuf = HDmalloc(ASYNC_TCONV_BENCH_NUM_ELEMS * sizeof(tconv_bench_cmpd_t))))
+        TEST_ERROR;
+    if (NULL == (cmpd_rbuf = HDmalloc(ASYNC_TCONV_BENCH_NUM_ELEMS * sizeof(tconv_bench_cmpd_t))))
+        TEST_ERROR;
+
+    /* Holds data in its file representation, which is never larger than in memory */
+    if (NULL == (raw_buf = HDmalloc(ASYNC_TCONV_BENCH_NUM_ELEMS * sizeof(tconv_bench_cmpd_t))))
+        TEST_ERROR;
+
+    for (i = 0; i < ASYNC_TCONV_BENCH_NUM_ELEMS; i++) {
+        wbuf[i]        = (double)((int)(i % 65536) - 32768);
+        cmpd_wbuf[i].a = (int)i;
+        cmpd_wbuf[i].b = (double)i * 0.5;
+        cmpd_wbuf[i].c = (short)(i % 32768);
+    }
+
+    /* Create the compound types, with the members in the opposite order in the file */
+    if ((cmpd_mtype_id = H5Tcreate(H5T_COMPOUND, sizeof(tconv_bench_cmpd_t))) < 0)
+        TEST_ERROR;
+    if (H5Tinsert(cmpd_mtype_id, "c", HOFFSET(tconv_bench_cmpd_t, c), H5T_NATIVE_SHORT) < 0)
+        TEST_ERROR;
+    if (H5Tinsert(cmpd_mtype_id, "b", HOFFSET(tconv_bench_cmpd_t, b), H5T_NATIVE_DOUBLE) < 0)
+        TEST_ERROR;
+    if (H5Tinsert(cmpd_mtype_id, "a", HOFFSET(tconv_bench_cmpd_t, a), H5T_NATIVE_INT) < 0)
+        TEST_ERROR;
+
+    if ((cmpd_ftype_id = H5Tcreate(H5T_COMPOUND, 4 + 8 + 2)) < 0)
+        TEST_ERROR;
+    if (H5Tinsert(cmpd_ftype_id, "a", 0, H5T_STD_I32BE) < 0)
+        TEST_ERROR;
+    if (H5Tinsert(cmpd_ftype_id, "b", 4, H5T_IEEE_F64BE) < 0)
+        TEST_ERROR;
+    if (H5Tinsert(cmpd_ftype_id, "c", 12, H5T_STD_I16BE) < 0)
+        TEST_ERROR;
+
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+
+    /* Create event stack */
+    if ((es_id = create_test_event_set()) < 0)
+        TEST_ERROR;
+
+    /* Create file and datasets synchronously so their creation isn't part of the timings */
+    if ((file_id = H5Fcreate(ASYNC_TCONV_BENCH_FILE, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((int_dset_id = H5Dcreate2(file_id, ASYNC_TCONV_BENCH_INT_DSET_NAME, H5T_STD_I16BE, space_id,
+                                  H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((cmpd_dset_id = H5Dcreate2(file_id, ASYNC_TCONV_BENCH_CMPD_DSET_NAME, cmpd_ftype_id, space_id,
+                                   H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    compute_iters_per_sec = calibrate_compute_kernel();
+
+    PASSED();
+
+    BEGIN_MULTIPART
+    {
+        PART_BEGIN(tconv_int16_write)
+        {
+            TESTING_2("H5Dwrite_async() from native double to big-endian int16");
+
+            if (async_tconv_bench_run(int_dset_id, H5T_NATIVE_DOUBLE, H5T_STD_I16BE, es_id, TRUE, wbuf,
+                                      raw_buf, compute_iters_per_sec, &times) < 0)
+                PART_TEST_ERROR(tconv_int16_write);
+
+            PASSED();
+
+            async_tconv_bench_report("H5Dwrite_async", &times);
+        }
+        PART_END(tconv_int16_write);
+
+        PART_BEGIN(tconv_int16_read)
+        {
+            TESTING_2("H5Dread_async() from big-endian int16 to native double");
+
+            HDmemset(rbuf, 0, ASYNC_TCONV_BENCH_NUM_ELEMS * sizeof(double));
+
+            if (async_tconv_bench_run(int_dset_id, H5T_NATIVE_DOUBLE, H5T_STD_I16BE, es_id, FALSE, rbuf,
+                                      raw_buf, compute_iters_per_sec, &times) < 0)
+                PART_TEST_ERROR(tconv_int16_read);
+
+            for (i = 0; i < ASYNC_TCONV_BENCH_NUM_ELEMS; i++)
+                if (rbuf[i] != wbuf[i]) {
+                    H5_FAILED();
+                    HDprintf("    data verification failed at index %zu\n", i);
+                    PART_ERROR(tconv_int16_read);
+                } /* end if */
+
+            PASSED();
+
+            async_tconv_bench_report("H5Dread_async", &times);
+        }
+        PART_END(tconv_int16_read);
+
+        PART_BEGIN(tconv_cmpd_write)
+        {
+            TESTING_2("H5Dwrite_async() with compound member reordering");
+
+            if (async_tconv_bench_run(cmpd_dset_id, cmpd_mtype_id, cmpd_ftype_id, es_id, TRUE, cmpd_wbuf,
+                                      raw_buf, compute_iters_per_sec, &times) < 0)
+                PART_TEST_ERROR(tconv_cmpd_write);
+
+            PASSED();
+
+            async_tconv_bench_report("H5Dwrite_async", &times);
+        }
+        PART_END(tconv_cmpd_write);
+
+        PART_BEGIN(tconv_cmpd_read)
+        {
+            TESTING_2("H5Dread_async() with compound member reordering");
+
+            HDmemset(cmpd_rbuf, 0, ASYNC_TCONV_BENCH_NUM_ELEMS * sizeof(tconv_bench_cmpd_t));
+
+            if (async_tconv_bench_run(cmpd_dset_id, cmpd_mtype_id, cmpd_ftype_id, es_id, FALSE, cmpd_rbuf,
+                                      raw_buf, compute_iters_per_sec, &times) < 0)
+                PART_TEST_ERROR(tconv_cmpd_read);
+
+            for (i = 0; i < ASYNC_TCONV_BENCH_NUM_ELEMS; i++)
+                if (cmpd_rbuf[i].a != cmpd_wbuf[i].a || cmpd_rbuf[i].b != cmpd_wbuf[i].b ||
+                    cmpd_rbuf[i].c != cmpd_wbuf[i].c) {
+                    H5_FAILED();
+                    HDprintf("    data verification failed at index %zu\n", i);
+                    PART_ERROR(tconv_cmpd_read);
+                } /* end if */
+
+            PASSED();
+
+            async_tconv_bench_report("H5Dread_async", &times);
+        }
+        PART_END(tconv_cmpd_read);
+    }
+    END_MULTIPART;
+
+    TESTING_2("test cleanup");
+
+    /* Wait for the event stack to complete */
+    if (H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+        TEST_ERROR;
+    if (op_failed)
+        TEST_ERROR;
+
+    if (H5Dclose(cmpd_dset_id) < 0)
+        TEST_ERROR;
+    if (H5Dclose(int_dset_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+    if (H5Tclose(cmpd_ftype_id) < 0)
+        TEST_ERROR;
+    if (H5Tclose(cmpd_mtype_id) < 0)
+        TEST_ERROR;
+    if (H5ESclose(es_id) < 0)
+        TEST_ERROR;
+
+    HDfree(raw_buf);
+    HDfree(cmpd_rbuf);
+    HDfree(cmpd_wbuf);
+    HDfree(rbuf);
+    HDfree(wbuf);
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(cmpd_dset_id);
+        H5Dclose(int_dset_id);
+        H5Fclose(file_id);
+        H5Sclose(space_id);
+        H5Tclose(cmpd_ftype_id);
+        H5Tclose(cmpd_mtype_id);
+        H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed);
+        H5ESclose(es_id);
+    }
+    H5E_END_TRY;
+
+    HDfree(raw_buf);
+    HDfree(cmpd_rbuf);
+    HDfree(cmpd_wbuf);
+    HDfree(rbuf);
+    HDfree(wbuf);
+
+    return 1;
+} /* end test_async_tconv_benchmark() */
+
+/*
+ * Runs the type conversion benchmark for either writes or reads of
+ * a whole dataset. Each iteration times synchronous I/O using the
+ * file datatype in memory, so no conversion is needed, then with the
+ * given memory datatype, then computes on its own for as long as the
+ * converting I/O took, or HDF5_API_TEST_ASYNC_COMPUTE_TIME seconds.
+ * Finally the async I/O is issued, timing the call itself, the
+ * computation is run, and H5ESwait is timed. The buffer holds the
+ * data written or read with conversion at the end.
+ */
+static int
+async_tconv_bench_run(hid_t dset_id, hid_t mem_type_id, hid_t file_type_id, hid_t es_id, hbool_t is_write,
+                      void *buf, void *raw_buf, double compute_iters_per_sec,
+                      async_tconv_bench_times_t *times)
+{
+    const char *compute_time_str = HDgetenv(HDF5_API_TEST_ASYNC_COMPUTE_TIME);
+    size_t      num_in_progress;
+    size_t      compute_iters;
+    size_t      i;
+    hbool_t     op_failed;
+    double      start_time, wait_start_time, iter_sync_time;
+    herr_t      status;
+
+    HDmemset(times, 0, sizeof(*times));
+
+    /* Give the raw buffer valid file data for the unconverted writes */
+    if (is_write && H5Dread(dset_id, file_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, raw_buf) < 0)
+        return -1;
+
+    for (i = 0; i < ASYNC_TCONV_BENCH_NUM_ITERS; i++) {
+        /* Time the I/O without conversion */
+        start_time = get_wall_time();
+
+        if (is_write)
+            status = H5Dwrite(dset_id, file_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, raw_buf);
+        else
+            status = H5Dread(dset_id, file_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, raw_buf);
+
+        if (status < 0) {
+            HDprintf("    synchronous dataset %s without conversion failed\n", is_write ? "write" : "read");
+            return -1;
+        }
+
+        times->noconv_time += get_wall_time() - start_time;
+
+        /* Time the I/O with conversion */
+        start_time = get_wall_time();
+
+        if (is_write)
+            status = H5Dwrite(dset_id, mem_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+        else
+            status = H5Dread(dset_id, mem_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+
+        if (status < 0) {
+            HDprintf("    synchronous dataset %s with conversion failed\n", is_write ? "write" : "read");
+            return -1;
+        }
+
+        iter_sync_time = get_wall_time() - start_time;
+        times->sync_time += iter_sync_time;
+
+        if (compute_time_str && HDatof(compute_time_str) > 0.0)
+            compute_iters = (size_t)(HDatof(compute_time_str) * compute_iters_per_sec);
+        else
+            compute_iters = (size_t)(iter_sync_time * compute_iters_per_sec);
+
+        /* Time the computation on its own */
+        start_time = get_wall_time();
+        run_compute_kernel(compute_iters);
+        times->compute_time += get_wall_time() - start_time;
+
+        /* Issue the async I/O, compute, then wait for the I/O to complete */
+        start_time = get_wall_time();
+
+        if (is_write)
+            status = H5Dwrite_async(dset_id, mem_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf, es_id);
+        else
+            status = H5Dread_async(dset_id, mem_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf, es_id);
+
+        times->call_time += get_wall_time() - start_time;
+
+        if (status < 0) {
+            HDprintf("    async dataset %s failed\n", is_write ? "write" : "read");
+            return -1;
+        }
+
+        run_compute_kernel(compute_iters);
+
+        wait_start_time = get_wall_time();
+
+        if (H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0)
+            return -1;
+        if (op_failed) {
+            HDprintf("    async dataset %s failed\n", is_write ? "write" : "read");
+            return -1;
+        }
+
+        times->wait_time += get_wall_time() - wait_start_time;
+        times->async_time += get_wall_time() - start_time;
+    }
+
+    return 0;
+} /* end async_tconv_bench_run() */
+
+/*
+ * Prints the results of the type conversion benchmark. The conversion
+ * cost is the extra time synchronous I/O took with conversion. If the
+ * time spent inside the async call is at least half of that, the
+ * conversion is taken to have run on the calling thread.
+ */
+static void
+async_tconv_bench_report(const char *op_name, const async_tconv_bench_times_t *times)
+{
+    double conv_time    = MAX(0.0, times->sync_time - times->noconv_time);
+    double max_saving   = MIN(times->sync_time, times->compute_time);
+    double overlap_frac = 0.0;
+
+    if (max_saving > 0.0)
+        overlap_frac = (times->sync_time + times->compute_time - times->async_time) / max_saving;
+    overlap_frac = MAX(0.0, MIN(1.0, overlap_frac));
+
+    HDprintf("    sync I/O: %.6f s without conversion, %.6f s with conversion (%.6f s converting)\n",
+             times->noconv_time, times->sync_time, conv_time);
+    HDprintf("    %s call: %.6f s, H5ESwait after computing: %.6f s, overlap fraction: %.2f%%\n", op_name,
+             times->call_time, times->wait_time, overlap_frac * 100.0);
+    if (conv_time > 0.0)
+        HDprintf("    conversion appears to run %s (call time is %.2f%% of conversion time)\n",
+                 (times->call_time >= 0.5 * conv_time) ? "on the calling thread" : "in the background",
+                 times->call_time / conv_time * 100.0);
+} /* end async_tconv_bench_report() */
+
+/*
+ * Cleanup temporary test files
+ */
+static void
+cleanup_files(void)
+{
+    char file_name[64];
+    int  i;
+
+    H5Fdelete(ASYNC_VOL_TEST_FILE, H5P_DEFAULT);
+    H5Fdelete(ASYNC_OVERLAP_BENCH_FILE, H5P_DEFAULT);
+    H5Fdelete(ASYNC_ES_SCALING_BENCH_FILE, H5P_DEFAULT);
+    H5Fdelete(ASYNC_POLL_BENCH_FILE, H5P_DEFAULT);
+    H5Fdelete(ASYNC_ERR_BENCH_FILE, H5P_DEFAULT);
+    H5Fdelete(ASYNC_MD_BENCH_FILE, H5P_DEFAULT);
+    H5Fdelete(ASYNC_STREAM_BENCH_FILE, H5P_DEFAULT);
+    H5Fdelete(ASYNC_TCONV_BENCH_FILE, H5P_DEFAULT);
+    for (i = 0; i < ASYNC_CKPT_BENCH_NUM_FILES; i++) {
+        HDsnprintf(file_name, 64, ASYNC_CKPT_BENCH_FILE_PRINTF, i);
+        H5Fdelete(file_name, H5P_DEFAULT);
+    } /* end for */
+    for (i = 0; i <= max_printf_file; i++) {
+        HDsnprintf(file_name, 64, ASYNC_VOL_TEST_FILE_PRINTF, i);
+        H5Fdelete(file_name, H5P_DEFAULT);
+    } /* end for */
+}
+
+int
+vol_async_test(void)
+{
+    size_t i;
+    int    nerrors;
+
+    HDprintf("**********************************************\n");
+    HDprintf("*                                            *\n");
+    HDprintf("*             VOL Async Tests                *\n");
+    HDprintf("*                                            *\n");
+    HDprintf("**********************************************\n\n");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_ASYNC)) {
+        SKIPPED();
+        HDprintf("    Async APIs aren't supported with this connector\n");
+        return 0;
+    }
+
+    if (open_async_trace_file(-1) < 0)
+        return 1;
+
+    for (i = 0, nerrors = 0; i < ARRAY_LENGTH(async_tests); i++) {
+        nerrors += (*async_tests[i])() ? 1 : 0;
+    }
+
+    close_async_trace_file();
+
     HDprintf("\n");
 
     HDprintf("Cleaning up testing files\n");
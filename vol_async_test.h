@@ -26,4 +26,85 @@ int vol_async_test(void);
 #define ASYNC_VOL_TEST_FILE        "async_vol_test.h5"
 #define ASYNC_VOL_TEST_FILE_PRINTF "async_vol_test_%d.h5"
 
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define ASYNC_OVERLAP_BENCH_NUM_ELEMS 16777216
+#define ASYNC_OVERLAP_BENCH_NUM_ITERS 5
+#else
+#define ASYNC_OVERLAP_BENCH_NUM_ELEMS 65536
+#define ASYNC_OVERLAP_BENCH_NUM_ITERS 2
+#endif
+#define ASYNC_OVERLAP_BENCH_FILE      "async_overlap_bench.h5"
+#define ASYNC_OVERLAP_BENCH_DSET_NAME "overlap_bench_dset"
+
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define ASYNC_ES_SCALING_BENCH_OP_COUNTS {1000, 10000, 100000}
+#else
+#define ASYNC_ES_SCALING_BENCH_OP_COUNTS {100, 1000}
+#endif
+#define ASYNC_ES_SCALING_BENCH_ES_COUNTS {1, 16}
+#define ASYNC_ES_SCALING_BENCH_FILE      "async_es_scaling_bench.h5"
+#define ASYNC_ES_SCALING_BENCH_DSET_NAME "es_scaling_bench_dset"
+
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define ASYNC_POLL_BENCH_NUM_OPS 10000
+#else
+#define ASYNC_POLL_BENCH_NUM_OPS 1000
+#endif
+#define ASYNC_POLL_BENCH_WAIT_TIMEOUT 1000000 /* 1 ms, in nanoseconds */
+#define ASYNC_POLL_BENCH_FILE         "async_poll_bench.h5"
+#define ASYNC_POLL_BENCH_DSET_NAME    "poll_bench_dset"
+
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define ASYNC_ERR_BENCH_NUM_OPS 10000
+#else
+#define ASYNC_ERR_BENCH_NUM_OPS 1000
+#endif
+#define ASYNC_ERR_BENCH_FILE       "async_err_bench.h5"
+#define ASYNC_ERR_BENCH_DSET_NAME  "err_bench_dset"
+#define ASYNC_ERR_BENCH_GROUP_NAME "err_bench_group"
+
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define ASYNC_CKPT_BENCH_STEP_ELEMS 1048576
+#define ASYNC_CKPT_BENCH_NUM_STEPS  100
+#define ASYNC_CKPT_BENCH_NUM_FILES  4
+#else
+#define ASYNC_CKPT_BENCH_STEP_ELEMS 16384
+#define ASYNC_CKPT_BENCH_NUM_STEPS  10
+#define ASYNC_CKPT_BENCH_NUM_FILES  2
+#endif
+#define ASYNC_CKPT_BENCH_FILE_PRINTF      "async_ckpt_bench_%d.h5"
+#define ASYNC_CKPT_BENCH_DSET_NAME_PRINTF "step_%d"
+
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define ASYNC_MD_BENCH_NUM_OPS 10000
+#else
+#define ASYNC_MD_BENCH_NUM_OPS 500
+#endif
+#define ASYNC_MD_BENCH_FILE             "async_md_bench.h5"
+#define ASYNC_MD_BENCH_SYNC_GROUP_NAME  "sync_container"
+#define ASYNC_MD_BENCH_ASYNC_GROUP_NAME "async_container"
+#define ASYNC_MD_BENCH_ATTR_NAME        "attr"
+
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define ASYNC_STREAM_BENCH_NUM_APPENDS 100000
+#else
+#define ASYNC_STREAM_BENCH_NUM_APPENDS 1000
+#endif
+#define ASYNC_STREAM_BENCH_RECORD_SIZE 16
+#define ASYNC_STREAM_BENCH_CHUNK_SIZE  4096
+#define ASYNC_STREAM_BENCH_NUM_WINDOWS 10
+#define ASYNC_STREAM_BENCH_FILE        "async_stream_bench.h5"
+#define ASYNC_STREAM_BENCH_DSET_NAME   "stream_bench_dset"
+
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define ASYNC_TCONV_BENCH_NUM_ELEMS 4194304
+#define ASYNC_TCONV_BENCH_NUM_ITERS 3
+#else
+#define ASYNC_TCONV_BENCH_NUM_ELEMS 65536
+#define ASYNC_TCONV_BENCH_NUM_ITERS 2
+#endif
+#define ASYNC_TCONV_BENCH_FILE           "async_tconv_bench.h5"
+#define ASYNC_TCONV_BENCH_INT_DSET_NAME  "tconv_bench_int16_dset"
+#define ASYNC_TCONV_BENCH_CMPD_DSET_NAME "tconv_bench_cmpd_dset"
+
 #endif
@@ -27,6 +27,16 @@ static int test_group(void);
 static int test_link(void);
 static int test_ocopy_orefresh(void);
 static int test_file_reopen(void);
+static int test_async_weak_scaling_benchmark(void);
+
+static int  par_async_scaling_bench_run(hsize_t base_nelems, double compute_iters_per_sec,
+                                        double *sync_io_time, double *compute_time, double *async_time,
+                                        double *wait_time, double *local_mib);
+static int  par_async_scaling_bench_value(hsize_t index, size_t write_num);
+static void par_async_scaling_bench_fill(int *buf, hsize_t local_offset, hsize_t local_nelems,
+                                         size_t write_num);
+static int  par_async_scaling_bench_report(double sync_io_time, double compute_time, double async_time,
+                                           double wait_time, double local_mib);
 
 /*
  * The array of parallel async tests to be performed.
@@ -45,6 +55,7 @@ static int (*par_async_tests[])(void) = {
     test_link,
     test_ocopy_orefresh,
     test_file_reopen,
+    test_async_weak_scaling_benchmark,
 };
 
 hbool_t coll_metadata_read = TRUE;
@@ -104,7 +115,7 @@ test_one_dataset_io(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Create file asynchronously */
@@ -470,7 +481,7 @@ test_multi_dataset_io(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Create file asynchronously */
@@ -796,7 +807,7 @@ test_multi_file_dataset_io(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Calculate size of data buffers - first dimension is skipped in calculation */
@@ -1219,7 +1230,7 @@ test_multi_file_grp_dset_io(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Calculate size of data buffers - first dimension is skipped in calculation */
@@ -1663,7 +1674,7 @@ test_set_extent(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Create file asynchronously */
@@ -1971,7 +1982,7 @@ test_attribute_exists(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Open file asynchronously */
@@ -2124,7 +2135,7 @@ test_attribute_io(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Open file asynchronously */
@@ -2331,7 +2342,7 @@ test_attribute_io_tconv(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Open file asynchronously */
@@ -2560,7 +2571,7 @@ test_attribute_io_compound(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Open file asynchronously */
@@ -2937,7 +2948,7 @@ test_group(void)
     }
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Open file asynchronously */
@@ -3117,7 +3128,7 @@ test_link(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Open file asynchronously */
@@ -3372,7 +3383,7 @@ test_ocopy_orefresh(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Open file asynchronously */
@@ -3518,7 +3529,7 @@ test_file_reopen(void)
         TEST_ERROR;
 
     /* Create event stack */
-    if ((es_id = H5EScreate()) < 0)
+    if ((es_id = create_test_event_set()) < 0)
         TEST_ERROR;
 
     /* Open file asynchronously */
@@ -3570,6 +3581,376 @@ error:
     return 1;
 }
 
+/*
+ * A benchmark to measure how well async collective dataset writes
+ * overlap with computation as the number of ranks and the amount of
+ * data per rank grow. Each rank's share of a shared dataset is given
+ * by the parallel scaling mode, and is multiplied by each of several
+ * factors in turn. For each, the collective write is timed with the
+ * synchronous API and a compute kernel is timed on its own, then the
+ * write is issued with H5Dwrite_async while every rank computes, and
+ * each rank waits for it with H5ESwait. If the connector's background
+ * thread serialized the collective writes across ranks rather than
+ * letting them proceed together behind the computation, the overlap
+ * fraction would drop and the time ranks spend in H5ESwait would grow
+ * with the number of ranks.
+ */
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define ASYNC_SCALING_BENCH_BASE_NUM_ELEMS 4194304
+#define ASYNC_SCALING_BENCH_VOLUME_FACTORS {1, 4, 16}
+#define ASYNC_SCALING_BENCH_NUM_ITERS      5
+#else
+#define ASYNC_SCALING_BENCH_BASE_NUM_ELEMS 16384
+#define ASYNC_SCALING_BENCH_VOLUME_FACTORS {1, 4}
+#define ASYNC_SCALING_BENCH_NUM_ITERS      2
+#endif
+#define ASYNC_SCALING_BENCH_FILE_NAME "async_scaling_bench_parallel.h5"
+#define ASYNC_SCALING_BENCH_DSET_NAME "async_scaling_bench_dset"
+static int
+test_async_weak_scaling_benchmark(void)
+{
+    hsize_t volume_factors[] = ASYNC_SCALING_BENCH_VOLUME_FACTORS;
+    size_t  i;
+    double  compute_iters_per_sec;
+    double  sync_io_time, compute_time, async_time, wait_time;
+    double  local_mib;
+
+    TESTING_MULTIPART("parallel async I/O and compute overlap scaling");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC)) {
+        if (MAINPROCESS) {
+            SKIPPED();
+            HDprintf("    API functions for basic file or dataset aren't supported with this connector\n");
+        }
+
+        return 0;
+    }
+
+    TESTING_2("test setup");
+
+    compute_iters_per_sec = calibrate_compute_kernel();
+
+    PASSED();
+
+    BEGIN_MULTIPART
+    {
+        for (i = 0; i < ARRAY_LENGTH(volume_factors); i++) {
+            PART_BEGIN(async_scaling)
+            {
+                char test_name[128];
+
+                HDsnprintf(test_name, sizeof(test_name), "async collective writes with %llux per-rank volume",
+                           (unsigned long long)volume_factors[i]);
+
+                TESTING_2(test_name);
+
+                if (par_async_scaling_bench_run(ASYNC_SCALING_BENCH_BASE_NUM_ELEMS * volume_factors[i],
+                                                compute_iters_per_sec, &sync_io_time, &compute_time,
+                                                &async_time, &wait_time, &local_mib) < 0)
+                    PART_TEST_ERROR(async_scaling);
+
+                PASSED();
+
+                if (par_async_scaling_bench_report(sync_io_time, compute_time, async_time, wait_time,
+                                                   local_mib) < 0)
+                    PART_ERROR(async_scaling);
+            }
+            PART_END(async_scaling);
+        }
+    }
+    END_MULTIPART;
+
+    return 0;
+
+error:
+    return 1;
+}
+
+/*
+ * Runs the async scaling benchmark for a base dataset size, returning
+ * the total time this rank spent over ASYNC_SCALING_BENCH_NUM_ITERS
+ * iterations on the synchronous collective write alone, on computation
+ * alone, on the async write overlapped with computation and in
+ * H5ESwait, along with the amount of data this rank wrote in each
+ * iteration. All ranks compute for the same time, so that the slowest
+ * rank's I/O is what the computation has to hide. Failures on any rank
+ * are agreed on before each collective operation, so that all ranks
+ * give up together. Must be called by all MPI ranks.
+ */
+static int
+par_async_scaling_bench_run(hsize_t base_nelems, double compute_iters_per_sec, double *sync_io_time,
+                            double *compute_time, double *async_time, double *wait_time, double *local_mib)
+{
+    const char *compute_time_str = HDgetenv(HDF5_API_TEST_ASYNC_COMPUTE_TIME);
+    hsize_t     global_nelems, local_nelems, local_offset;
+    hsize_t     dims[1];
+    hsize_t     j;
+    size_t      num_in_progress;
+    size_t      compute_iters;
+    size_t      last_write_num = (2 * ASYNC_SCALING_BENCH_NUM_ITERS) - 1;
+    size_t      i;
+    hbool_t     op_failed;
+    double      start_time, wait_start_time, iter_io_time;
+    hid_t       file_id   = H5I_INVALID_HID;
+    hid_t       fapl_id   = H5I_INVALID_HID;
+    hid_t       dxpl_id   = H5I_INVALID_HID;
+    hid_t       dset_id   = H5I_INVALID_HID;
+    hid_t       fspace_id = H5I_INVALID_HID;
+    hid_t       mspace_id = H5I_INVALID_HID;
+    hid_t       es_id     = H5I_INVALID_HID;
+    int         failed    = 0;
+    int        *buf       = NULL;
+    int         ret_value = -1;
+
+    *sync_io_time = *compute_time = *async_time = *wait_time = 0.0;
+
+    get_parallel_scaling_share(base_nelems, &global_nelems, &local_nelems, &local_offset);
+
+    *local_mib = (double)(local_nelems * sizeof(int)) / (1024.0 * 1024.0);
+
+    if (NULL == (buf = HDmalloc(MAX(local_nelems, 1) * sizeof(int)))) {
+        HDprintf("    couldn't allocate buffer for dataset I/O\n");
+        failed = 1;
+    }
+
+    if (!failed && (fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, coll_metadata_read)) < 0)
+        failed = 1;
+
+    if (!failed && ((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0 ||
+                    H5Pset_dxpl_mpio(dxpl_id, H5FD_MPIO_COLLECTIVE) < 0))
+        failed = 1;
+
+    if (!failed && (es_id = create_test_event_set()) < 0)
+        failed = 1;
+
+    if (any_parallel_rank_failed(failed))
+        goto done;
+
+    /* Create file and dataset synchronously so their creation isn't part of the timings */
+    if ((file_id = H5Fcreate(ASYNC_SCALING_BENCH_FILE_NAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
+        HDprintf("    couldn't create file '%s'\n", ASYNC_SCALING_BENCH_FILE_NAME);
+        failed = 1;
+    }
+
+    dims[0] = global_nelems;
+
+    if ((fspace_id = H5Screate_simple(1, dims, NULL)) < 0)
+        failed = 1;
+
+    if (any_parallel_rank_failed(failed))
+        goto done;
+
+    if ((dset_id = H5Dcreate2(file_id, ASYNC_SCALING_BENCH_DSET_NAME, H5T_NATIVE_INT, fspace_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        HDprintf("    couldn't create dataset '%s'\n", ASYNC_SCALING_BENCH_DSET_NAME);
+        failed = 1;
+    }
+
+    /*
+     * With strong scaling, there may be more ranks than
+     * elements, leaving some ranks with nothing to do.
+     */
+    if (!failed) {
+        if (local_nelems > 0) {
+            if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, &local_offset, NULL, &local_nelems, NULL) < 0)
+                failed = 1;
+        }
+        else if (H5Sselect_none(fspace_id) < 0)
+            failed = 1;
+    }
+
+    if (!failed && (mspace_id = H5Screate_simple(1, &local_nelems, NULL)) < 0)
+        failed = 1;
+
+    for (i = 0; i < ASYNC_SCALING_BENCH_NUM_ITERS; i++) {
+        /* Time the collective write on its own with the synchronous API */
+        par_async_scaling_bench_fill(buf, local_offset, local_nelems, 2 * i);
+
+        if (any_parallel_rank_failed(failed))
+            goto done;
+
+        start_time = get_wall_time();
+
+        if (H5Dwrite(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, dxpl_id, buf) < 0) {
+            HDprintf("    synchronous collective dataset write failed\n");
+            failed = 1;
+        }
+
+        iter_io_time = get_wall_time() - start_time;
+        *sync_io_time += iter_io_time;
+
+        /*
+         * Unless a compute time was given, match the compute time to the
+         * slowest rank's I/O time, so that perfect overlap would hide all
+         * of the I/O.
+         */
+        if (MPI_SUCCESS != MPI_Allreduce(MPI_IN_PLACE, &iter_io_time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD))
+            goto done;
+
+        if (compute_time_str && HDatof(compute_time_str) > 0.0)
+            compute_iters = (size_t)(HDatof(compute_time_str) * compute_iters_per_sec);
+        else
+            compute_iters = (size_t)(iter_io_time * compute_iters_per_sec);
+
+        /* Time the computation on its own */
+        start_time = get_wall_time();
+        run_compute_kernel(compute_iters);
+        *compute_time += get_wall_time() - start_time;
+
+        /*
+         * Issue the async collective write, compute, then wait for the write
+         * to complete. The async write uses different data from the sync
+         * write, so that verification shows the async write took effect.
+         */
+        par_async_scaling_bench_fill(buf, local_offset, local_nelems, (2 * i) + 1);
+
+        if (any_parallel_rank_failed(failed))
+            goto done;
+
+        start_time = get_wall_time();
+
+        if (H5Dwrite_async(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, dxpl_id, buf, es_id) < 0) {
+            HDprintf("    async collective dataset write failed\n");
+            failed = 1;
+        }
+
+        run_compute_kernel(compute_iters);
+
+        wait_start_time = get_wall_time();
+
+        if (H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed) < 0 || op_failed) {
+            HDprintf("    async collective dataset write failed\n");
+            failed = 1;
+        }
+
+        *wait_time += get_wall_time() - wait_start_time;
+        *async_time += get_wall_time() - start_time;
+    }
+
+    if (any_parallel_rank_failed(failed))
+        goto done;
+
+    /* Verify the data written by this rank's last async write */
+    HDmemset(buf, 0, local_nelems * sizeof(int));
+
+    if (H5Dread(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, dxpl_id, buf) < 0) {
+        HDprintf("    couldn't read from dataset '%s'\n", ASYNC_SCALING_BENCH_DSET_NAME);
+        failed = 1;
+    }
+
+    for (j = 0; !failed && j < local_nelems; j++)
+        if (buf[j] != par_async_scaling_bench_value(local_offset + j, last_write_num))
+            failed = 1;
+
+    if (any_parallel_rank_failed(failed)) {
+        if (MAINPROCESS)
+            HDprintf("    data verification failed on at least one rank\n");
+        goto done;
+    }
+
+    ret_value = 0;
+
+done:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5ESwait(es_id, VOL_TEST_WAIT_FOREVER, &num_in_progress, &op_failed);
+        H5ESclose(es_id);
+        H5Fclose(file_id);
+        H5Pclose(dxpl_id);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+
+    HDfree(buf);
+
+    return ret_value;
+}
+
+/*
+ * Returns the value of the element at 'index' for a given write of the
+ * async scaling benchmark. Each write, synchronous or async, uses its
+ * own values, so that verification can tell which write took effect.
+ */
+static int
+par_async_scaling_bench_value(hsize_t index, size_t write_num)
+{
+    return (int)(((index * 2 * ASYNC_SCALING_BENCH_NUM_ITERS) + write_num) % (hsize_t)INT_MAX);
+}
+
+/*
+ * Fills this rank's buffer with the data for a given write of the
+ * async scaling benchmark.
+ */
+static void
+par_async_scaling_bench_fill(int *buf, hsize_t local_offset, hsize_t local_nelems, size_t write_num)
+{
+    hsize_t j;
+
+    for (j = 0; j < local_nelems; j++)
+        buf[j] = par_async_scaling_bench_value(local_offset + j, write_num);
+}
+
+/*
+ * Prints the results of the async scaling benchmark. The aggregate
+ * bandwidth of the synchronous and async writes is reported as for
+ * the other parallel scaling benchmarks, with the async rate counting
+ * the computation. The overlap fraction is computed from the slowest
+ * rank's times, as in the serial overlap benchmark, and the minimum,
+ * mean and maximum time ranks spent in H5ESwait are reported. Must be
+ * called by all MPI ranks.
+ */
+static int
+par_async_scaling_bench_report(double sync_io_time, double compute_time, double async_time, double wait_time,
+                               double local_mib)
+{
+    double total_mib = local_mib * ASYNC_SCALING_BENCH_NUM_ITERS;
+    double max_times[3];
+    double min_wait_time, max_wait_time, sum_wait_time;
+
+    max_times[0] = sync_io_time;
+    max_times[1] = compute_time;
+    max_times[2] = async_time;
+
+    if (report_parallel_scaling_timing("H5Dwrite", sync_io_time, total_mib, "MiB") < 0)
+        return -1;
+    if (report_parallel_scaling_timing("H5Dwrite_async + compute", async_time, total_mib, "MiB") < 0)
+        return -1;
+
+    if (MPI_SUCCESS != MPI_Allreduce(MPI_IN_PLACE, max_times, 3, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD))
+        return -1;
+    if (MPI_SUCCESS != MPI_Reduce(&wait_time, &min_wait_time, 1, MPI_DOUBLE, MPI_MIN, 0, MPI_COMM_WORLD))
+        return -1;
+    if (MPI_SUCCESS != MPI_Reduce(&wait_time, &max_wait_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD))
+        return -1;
+    if (MPI_SUCCESS != MPI_Reduce(&wait_time, &sum_wait_time, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD))
+        return -1;
+
+    if (MAINPROCESS) {
+        double max_saving   = MIN(max_times[0], max_times[1]);
+        double overlap_frac = 0.0;
+
+        if (max_saving > 0.0)
+            overlap_frac = (max_times[0] + max_times[1] - max_times[2]) / max_saving;
+        overlap_frac = MAX(0.0, MIN(1.0, overlap_frac));
+
+        HDprintf("    slowest rank: sync I/O %.6f s, compute %.6f s, async I/O + compute %.6f s\n",
+                 max_times[0], max_times[1], max_times[2]);
+        HDprintf("    overlap fraction: %.2f%% (over %d iterations)\n", overlap_frac * 100.0,
+                 ASYNC_SCALING_BENCH_NUM_ITERS);
+        HDprintf("    per-rank H5ESwait time min/avg/max: %.6f/%.6f/%.6f s\n", min_wait_time,
+                 sum_wait_time / (double)mpi_size, max_wait_time);
+    }
+
+    return 0;
+}
+#undef ASYNC_SCALING_BENCH_BASE_NUM_ELEMS
+#undef ASYNC_SCALING_BENCH_VOLUME_FACTORS
+#undef ASYNC_SCALING_BENCH_NUM_ITERS
+
 /*
  * Cleanup temporary test files
  */
@@ -3581,6 +3962,7 @@ cleanup_files(void)
 
     if (MAINPROCESS) {
         H5Fdelete(PAR_ASYNC_VOL_TEST_FILE, H5P_DEFAULT);
+        H5Fdelete(ASYNC_SCALING_BENCH_FILE_NAME, H5P_DEFAULT);
         for (i = 0; i <= max_printf_file; i++) {
             snprintf(file_name, 64, PAR_ASYNC_VOL_TEST_FILE_PRINTF, i);
             H5Fdelete(file_name, H5P_DEFAULT);
@@ -3592,6 +3974,7 @@ int
 vol_async_test_parallel(void)
 {
     size_t i;
+    int    trace_failed;
     int    nerrors;
 
     if (MAINPROCESS) {
@@ -3611,8 +3994,23 @@ vol_async_test_parallel(void)
         return 0;
     }
 
+    /* All ranks must agree on whether to run the tests, or the ranks that do will hang */
+    trace_failed = (open_async_trace_file(mpi_rank) < 0);
+
+    if (MPI_SUCCESS != MPI_Allreduce(MPI_IN_PLACE, &trace_failed, 1, MPI_INT, MPI_LOR, MPI_COMM_WORLD))
+        trace_failed = 1;
+
+    if (trace_failed) {
+        if (MAINPROCESS)
+            HDprintf("    couldn't open async trace file on all ranks\n");
+
+        close_async_trace_file();
+
+        return 1;
+    }
+
     for (i = 0, nerrors = 0; i < ARRAY_LENGTH(par_async_tests); i++) {
-        nerrors += (*par_async_tests[i])() ? 1 : 0;
+        nerrors += run_parallel_test(par_async_tests[i]) ? 1 : 0;
 
         if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
             if (MAINPROCESS)
@@ -3634,7 +4032,7 @@ vol_async_test_parallel(void)
     coll_metadata_read = FALSE;
 
     for (i = 0, nerrors = 0; i < ARRAY_LENGTH(par_async_tests); i++) {
-        nerrors += (*par_async_tests[i])() ? 1 : 0;
+        nerrors += run_parallel_test(par_async_tests[i]) ? 1 : 0;
 
         if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
             if (MAINPROCESS)
@@ -3647,6 +4045,8 @@ vol_async_test_parallel(void)
         HDprintf("Cleaning up testing files\n");
     }
 
+    close_async_trace_file();
+
     cleanup_files();
 
     return nerrors;
@@ -12,10 +12,581 @@
 
 #include "vol_attribute_test_parallel.h"
 
+static int test_create_write_read_attributes_collective(void);
+static int test_write_read_large_attribute_collective(void);
+
 /*
  * The array of parallel attribute tests to be performed.
  */
-static int (*par_attribute_tests[])(void) = {NULL};
+static int (*par_attribute_tests[])(void) = {
+    test_create_write_read_attributes_collective,
+    test_write_read_large_attribute_collective,
+};
+
+/*
+ * A test to check that many attributes can be collectively created
+ * and written on a group that is shared by all MPI ranks, then read
+ * back by every rank, as happens when all ranks of an application
+ * read their run configuration at startup. The number of attributes
+ * is enough to move the group's attributes from compact to dense
+ * storage, which is checked before the reads are timed. The
+ * attributes are read back both with collective and with
+ * independent metadata reads, and the time taken for each
+ * class of operation is reported.
+ */
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define ATTRIBUTE_COLL_TEST_NUM_ATTRS 1000
+#else
+#define ATTRIBUTE_COLL_TEST_NUM_ATTRS 16
+#endif
+#define ATTRIBUTE_COLL_TEST_MAX_COMPACT   8
+#define ATTRIBUTE_COLL_TEST_MIN_DENSE     6
+#define ATTRIBUTE_COLL_TEST_ATTR_DTYPE    H5T_NATIVE_INT
+#define ATTRIBUTE_COLL_TEST_GROUP_NAME    "collective_attribute_test"
+#define ATTRIBUTE_COLL_TEST_NAME_BUF_SIZE 64
+static int
+test_create_write_read_attributes_collective(void)
+{
+    H5O_native_info_t native_info;
+    H5O_info2_t       object_info;
+    hbool_t           is_native_vol = FALSE;
+    size_t            i, j;
+    double            start_time;
+    double            create_time, write_time, read_time;
+    char              attr_name[ATTRIBUTE_COLL_TEST_NAME_BUF_SIZE];
+    hid_t             file_id         = H5I_INVALID_HID;
+    hid_t             fapl_id         = H5I_INVALID_HID;
+    hid_t             container_group = H5I_INVALID_HID;
+    hid_t             group_id        = H5I_INVALID_HID;
+    hid_t             gcpl_id         = H5I_INVALID_HID;
+    hid_t             attr_id         = H5I_INVALID_HID;
+    hid_t             space_id        = H5I_INVALID_HID;
+    int               value;
+
+    TESTING_MULTIPART("collective attribute creation, write and read on a shared group");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_ATTR_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_OBJECT_MORE)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file, group, attribute, or object more aren't supported with "
+                 "this connector\n");
+        return 0;
+    }
+
+    TESTING_2("test setup");
+
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+        TEST_ERROR;
+
+    if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open file '%s'\n", vol_test_parallel_filename);
+        goto error;
+    }
+
+    if (H5VLobject_is_native(file_id, &is_native_vol) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't determine if connector is the native connector\n");
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, ATTRIBUTE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open container group '%s'\n", ATTRIBUTE_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((gcpl_id = H5Pcreate(H5P_GROUP_CREATE)) < 0)
+        TEST_ERROR;
+
+    if (H5Pset_attr_phase_change(gcpl_id, ATTRIBUTE_COLL_TEST_MAX_COMPACT, ATTRIBUTE_COLL_TEST_MIN_DENSE) <
+        0) {
+        H5_FAILED();
+        HDprintf("    couldn't set attribute phase change values\n");
+        goto error;
+    }
+
+    if ((group_id = H5Gcreate2(container_group, ATTRIBUTE_COLL_TEST_GROUP_NAME, H5P_DEFAULT, gcpl_id,
+                               H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create container sub-group '%s'\n", ATTRIBUTE_COLL_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((space_id = H5Screate(H5S_SCALAR)) < 0)
+        TEST_ERROR;
+
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR;
+    container_group = H5I_INVALID_HID;
+
+    PASSED();
+
+    BEGIN_MULTIPART
+    {
+        PART_BEGIN(H5Acreate_H5Awrite_collective)
+        {
+            TESTING_2("H5Acreate2 and H5Awrite by all ranks");
+
+            create_time = 0.0;
+            write_time  = 0.0;
+
+            if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+                H5_FAILED();
+                HDprintf("    MPI_Barrier failed\n");
+                PART_ERROR(H5Acreate_H5Awrite_collective);
+            }
+
+            for (i = 0; i < ATTRIBUTE_COLL_TEST_NUM_ATTRS; i++) {
+                HDsnprintf(attr_name, ATTRIBUTE_COLL_TEST_NAME_BUF_SIZE, "attr%zu", i);
+
+                value = (int)i;
+
+                start_time = get_wall_time();
+
+                if ((attr_id = H5Acreate2(group_id, attr_name, ATTRIBUTE_COLL_TEST_ATTR_DTYPE, space_id,
+                                          H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+                    H5_FAILED();
+                    HDprintf("    couldn't create attribute '%s'\n", attr_name);
+                    PART_ERROR(H5Acreate_H5Awrite_collective);
+                }
+
+                create_time += get_wall_time() - start_time;
+                start_time = get_wall_time();
+
+                if (H5Awrite(attr_id, ATTRIBUTE_COLL_TEST_ATTR_DTYPE, &value) < 0) {
+                    H5_FAILED();
+                    HDprintf("    couldn't write to attribute '%s'\n", attr_name);
+                    PART_ERROR(H5Acreate_H5Awrite_collective);
+                }
+
+                write_time += get_wall_time() - start_time;
+
+                if (H5Aclose(attr_id) < 0) {
+                    H5_FAILED();
+                    HDprintf("    couldn't close attribute '%s'\n", attr_name);
+                    PART_ERROR(H5Acreate_H5Awrite_collective);
+                }
+                attr_id = H5I_INVALID_HID;
+            }
+
+            if (H5Oget_info3(group_id, &object_info, H5O_INFO_NUM_ATTRS) < 0) {
+                H5_FAILED();
+                HDprintf("    couldn't retrieve group info\n");
+                PART_ERROR(H5Acreate_H5Awrite_collective);
+            }
+
+            if (object_info.num_attrs != ATTRIBUTE_COLL_TEST_NUM_ATTRS) {
+                H5_FAILED();
+                HDprintf("    group had %llu attributes instead of %d\n",
+                         (unsigned long long)object_info.num_attrs, ATTRIBUTE_COLL_TEST_NUM_ATTRS);
+                PART_ERROR(H5Acreate_H5Awrite_collective);
+            }
+
+            /*
+             * Make sure the attributes were moved to dense storage, so
+             * that the reads below are timed against the dense case.
+             */
+            if (object_info.num_attrs <= ATTRIBUTE_COLL_TEST_MAX_COMPACT) {
+                H5_FAILED();
+                HDprintf("    group's %llu attributes don't exceed the maximum of %d in compact storage\n",
+                         (unsigned long long)object_info.num_attrs, ATTRIBUTE_COLL_TEST_MAX_COMPACT);
+                PART_ERROR(H5Acreate_H5Awrite_collective);
+            }
+
+            if (is_native_vol) {
+                if (H5Oget_native_info(group_id, &native_info, H5O_NATIVE_INFO_META_SIZE) < 0) {
+                    H5_FAILED();
+                    HDprintf("    couldn't retrieve native group info\n");
+                    PART_ERROR(H5Acreate_H5Awrite_collective);
+                }
+
+                /* Only dense attribute storage has a name index */
+                if (native_info.meta_size.attr.index_size == 0) {
+                    H5_FAILED();
+                    HDprintf("    group's attributes weren't moved to dense storage\n");
+                    PART_ERROR(H5Acreate_H5Awrite_collective);
+                }
+            }
+
+            PASSED();
+
+            if (report_parallel_collective_timing("H5Acreate2", create_time,
+                                                  (double)ATTRIBUTE_COLL_TEST_NUM_ATTRS, "attributes") < 0)
+                PART_ERROR(H5Acreate_H5Awrite_collective);
+            if (report_parallel_collective_timing("H5Awrite", write_time,
+                                                  (double)ATTRIBUTE_COLL_TEST_NUM_ATTRS, "attributes") < 0)
+                PART_ERROR(H5Acreate_H5Awrite_collective);
+        }
+        PART_END(H5Acreate_H5Awrite_collective);
+
+        if (attr_id >= 0) {
+            H5E_BEGIN_TRY
+            {
+                H5Aclose(attr_id);
+            }
+            H5E_END_TRY;
+            attr_id = H5I_INVALID_HID;
+        }
+
+        /*
+         * Read the attributes back with collective metadata reads,
+         * then again with independent metadata reads, re-opening
+         * the file each time so that the reads aren't satisfied
+         * from metadata that is already cached.
+         */
+        for (j = 0; j < 2; j++) {
+            hbool_t coll_md_read = (j == 0) ? TRUE : FALSE;
+
+            PART_BEGIN(H5Aread_all_ranks)
+            {
+                TESTING_2(coll_md_read ? "H5Aread by all ranks with collective metadata reads"
+                                       : "H5Aread by all ranks with independent metadata reads");
+
+                read_time = 0.0;
+
+                if (reopen_parallel_test_group(
+                        coll_md_read, "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_COLL_TEST_GROUP_NAME,
+                        &fapl_id, &file_id, &group_id) < 0) {
+                    H5_FAILED();
+                    PART_ERROR(H5Aread_all_ranks);
+                }
+
+                for (i = 0; i < ATTRIBUTE_COLL_TEST_NUM_ATTRS; i++) {
+                    HDsnprintf(attr_name, ATTRIBUTE_COLL_TEST_NAME_BUF_SIZE, "attr%zu", i);
+
+                    start_time = get_wall_time();
+
+                    if ((attr_id = H5Aopen(group_id, attr_name, H5P_DEFAULT)) < 0) {
+                        H5_FAILED();
+                        HDprintf("    couldn't open attribute '%s'\n", attr_name);
+                        PART_ERROR(H5Aread_all_ranks);
+                    }
+
+                    if (H5Aread(attr_id, ATTRIBUTE_COLL_TEST_ATTR_DTYPE, &value) < 0) {
+                        H5_FAILED();
+                        HDprintf("    couldn't read attribute '%s'\n", attr_name);
+                        PART_ERROR(H5Aread_all_ranks);
+                    }
+
+                    read_time += get_wall_time() - start_time;
+
+                    if (value != (int)i) {
+                        H5_FAILED();
+                        HDprintf("    attribute '%s' had value %d instead of %d\n", attr_name, value, (int)i);
+                        PART_ERROR(H5Aread_all_ranks);
+                    }
+
+                    if (H5Aclose(attr_id) < 0) {
+                        H5_FAILED();
+                        HDprintf("    couldn't close attribute '%s'\n", attr_name);
+                        PART_ERROR(H5Aread_all_ranks);
+                    }
+                    attr_id = H5I_INVALID_HID;
+                }
+
+                PASSED();
+
+                /* Every rank reads every attribute */
+                if (report_parallel_scaling_timing("H5Aopen/H5Aread", read_time,
+                                                   (double)ATTRIBUTE_COLL_TEST_NUM_ATTRS, "attributes") < 0)
+                    PART_ERROR(H5Aread_all_ranks);
+            }
+            PART_END(H5Aread_all_ranks);
+
+            if (attr_id >= 0) {
+                H5E_BEGIN_TRY
+                {
+                    H5Aclose(attr_id);
+                }
+                H5E_END_TRY;
+                attr_id = H5I_INVALID_HID;
+            }
+        }
+    }
+    END_MULTIPART;
+
+    TESTING_2("test cleanup");
+
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(gcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Aclose(attr_id);
+        H5Sclose(space_id);
+        H5Pclose(gcpl_id);
+        H5Gclose(group_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+/*
+ * A test to check that a large attribute can be collectively created
+ * and written on a dataset that is shared by all MPI ranks, then read
+ * back by every rank. The dataset is created so that its attributes
+ * are always kept in dense storage, which HDF5 requires for attributes
+ * larger than 64KiB.
+ */
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define ATTRIBUTE_LARGE_COLL_TEST_ATTR_NELEMS 262144
+#else
+#define ATTRIBUTE_LARGE_COLL_TEST_ATTR_NELEMS 20480
+#endif
+#define ATTRIBUTE_LARGE_COLL_TEST_ATTR_DTYPE H5T_NATIVE_INT
+#define ATTRIBUTE_LARGE_COLL_TEST_DTYPE_SIZE sizeof(int)
+#define ATTRIBUTE_LARGE_COLL_TEST_GROUP_NAME "collective_large_attribute_test"
+#define ATTRIBUTE_LARGE_COLL_TEST_DSET_NAME  "large_attribute_dset"
+#define ATTRIBUTE_LARGE_COLL_TEST_ATTR_NAME  "large_attribute"
+static int
+test_write_read_large_attribute_collective(void)
+{
+    hsize_t attr_dims[1] = {ATTRIBUTE_LARGE_COLL_TEST_ATTR_NELEMS};
+    size_t  i;
+    double  start_time;
+    double  write_time, read_time;
+    double  attr_mib;
+    hid_t   file_id         = H5I_INVALID_HID;
+    hid_t   fapl_id         = H5I_INVALID_HID;
+    hid_t   container_group = H5I_INVALID_HID;
+    hid_t   group_id        = H5I_INVALID_HID;
+    hid_t   dset_id         = H5I_INVALID_HID;
+    hid_t   dcpl_id         = H5I_INVALID_HID;
+    hid_t   attr_id         = H5I_INVALID_HID;
+    hid_t   dset_space_id   = H5I_INVALID_HID;
+    hid_t   attr_space_id   = H5I_INVALID_HID;
+    int    *write_buf       = NULL;
+    int    *read_buf        = NULL;
+
+    TESTING("collective write and read of a large attribute on a shared dataset");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_ATTR_BASIC)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file, group, dataset, or attribute aren't supported with this "
+                 "connector\n");
+        return 0;
+    }
+
+    attr_mib = (double)(ATTRIBUTE_LARGE_COLL_TEST_ATTR_NELEMS * ATTRIBUTE_LARGE_COLL_TEST_DTYPE_SIZE) /
+               (1024.0 * 1024.0);
+
+    if (NULL == (write_buf = HDmalloc(ATTRIBUTE_LARGE_COLL_TEST_ATTR_NELEMS *
+                                      ATTRIBUTE_LARGE_COLL_TEST_DTYPE_SIZE)) ||
+        NULL == (read_buf = HDmalloc(ATTRIBUTE_LARGE_COLL_TEST_ATTR_NELEMS *
+                                     ATTRIBUTE_LARGE_COLL_TEST_DTYPE_SIZE))) {
+        H5_FAILED();
+        HDprintf("    couldn't allocate buffers for attribute I/O\n");
+        goto error;
+    }
+
+    for (i = 0; i < ATTRIBUTE_LARGE_COLL_TEST_ATTR_NELEMS; i++)
+        write_buf[i] = (int)i;
+
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+        TEST_ERROR;
+
+    if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open file '%s'\n", vol_test_parallel_filename);
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, ATTRIBUTE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open container group '%s'\n", ATTRIBUTE_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((group_id = H5Gcreate2(container_group, ATTRIBUTE_LARGE_COLL_TEST_GROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create container sub-group '%s'\n", ATTRIBUTE_LARGE_COLL_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+
+    if (H5Pset_attr_phase_change(dcpl_id, 0, 0) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't set attribute phase change values\n");
+        goto error;
+    }
+
+    if ((dset_space_id = H5Screate(H5S_SCALAR)) < 0)
+        TEST_ERROR;
+    if ((attr_space_id = H5Screate_simple(1, attr_dims, NULL)) < 0)
+        TEST_ERROR;
+
+    if ((dset_id = H5Dcreate2(group_id, ATTRIBUTE_LARGE_COLL_TEST_DSET_NAME, H5T_NATIVE_INT, dset_space_id,
+                              H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create dataset '%s'\n", ATTRIBUTE_LARGE_COLL_TEST_DSET_NAME);
+        goto error;
+    }
+
+    if ((attr_id = H5Acreate2(dset_id, ATTRIBUTE_LARGE_COLL_TEST_ATTR_NAME,
+                              ATTRIBUTE_LARGE_COLL_TEST_ATTR_DTYPE, attr_space_id, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create attribute '%s'\n", ATTRIBUTE_LARGE_COLL_TEST_ATTR_NAME);
+        goto error;
+    }
+
+    if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+        H5_FAILED();
+        HDprintf("    MPI_Barrier failed\n");
+        goto error;
+    }
+
+    start_time = get_wall_time();
+
+    if (H5Awrite(attr_id, ATTRIBUTE_LARGE_COLL_TEST_ATTR_DTYPE, write_buf) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't write to attribute '%s'\n", ATTRIBUTE_LARGE_COLL_TEST_ATTR_NAME);
+        goto error;
+    }
+
+    write_time = get_wall_time() - start_time;
+
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR;
+    attr_id = H5I_INVALID_HID;
+
+    /*
+     * Close and re-open the file so that the attribute
+     * isn't read back from metadata that is still cached.
+     */
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = H5I_INVALID_HID;
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    group_id = H5I_INVALID_HID;
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR;
+    container_group = H5I_INVALID_HID;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+    file_id = H5I_INVALID_HID;
+
+    if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDONLY, fapl_id)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't re-open file '%s'\n", vol_test_parallel_filename);
+        goto error;
+    }
+
+    if ((dset_id = H5Dopen2(file_id,
+                            "/" ATTRIBUTE_TEST_GROUP_NAME "/" ATTRIBUTE_LARGE_COLL_TEST_GROUP_NAME
+                            "/" ATTRIBUTE_LARGE_COLL_TEST_DSET_NAME,
+                            H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open dataset '%s'\n", ATTRIBUTE_LARGE_COLL_TEST_DSET_NAME);
+        goto error;
+    }
+
+    if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+        H5_FAILED();
+        HDprintf("    MPI_Barrier failed\n");
+        goto error;
+    }
+
+    start_time = get_wall_time();
+
+    if ((attr_id = H5Aopen(dset_id, ATTRIBUTE_LARGE_COLL_TEST_ATTR_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open attribute '%s'\n", ATTRIBUTE_LARGE_COLL_TEST_ATTR_NAME);
+        goto error;
+    }
+
+    if (H5Aread(attr_id, ATTRIBUTE_LARGE_COLL_TEST_ATTR_DTYPE, read_buf) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't read attribute '%s'\n", ATTRIBUTE_LARGE_COLL_TEST_ATTR_NAME);
+        goto error;
+    }
+
+    read_time = get_wall_time() - start_time;
+
+    for (i = 0; i < ATTRIBUTE_LARGE_COLL_TEST_ATTR_NELEMS; i++)
+        if (read_buf[i] != (int)i) {
+            H5_FAILED();
+            HDprintf("    attribute '%s' data verification failed at index %zu\n",
+                     ATTRIBUTE_LARGE_COLL_TEST_ATTR_NAME, i);
+            goto error;
+        }
+
+    HDfree(read_buf);
+    read_buf = NULL;
+    HDfree(write_buf);
+    write_buf = NULL;
+
+    if (H5Sclose(attr_space_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(dset_space_id) < 0)
+        TEST_ERROR;
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    /* All ranks write the attribute together, but each rank reads all of it */
+    if (report_parallel_collective_timing("H5Awrite (large)", write_time, attr_mib, "MiB") < 0)
+        return 1;
+    if (report_parallel_scaling_timing("H5Aopen/H5Aread (large)", read_time, attr_mib, "MiB") < 0)
+        return 1;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (read_buf)
+            HDfree(read_buf);
+        if (write_buf)
+            HDfree(write_buf);
+        H5Sclose(attr_space_id);
+        H5Sclose(dset_space_id);
+        H5Aclose(attr_id);
+        H5Pclose(dcpl_id);
+        H5Dclose(dset_id);
+        H5Gclose(group_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
 
 int
 vol_attribute_test_parallel(void)
@@ -32,7 +603,7 @@ vol_attribute_test_parallel(void)
     }
 
     for (i = 0, nerrors = 0; i < ARRAY_LENGTH(par_attribute_tests); i++) {
-        /* nerrors += (*par_attribute_tests[i])() ? 1 : 0; */
+        nerrors += run_parallel_test(par_attribute_tests[i]) ? 1 : 0;
 
         if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
             if (MAINPROCESS)
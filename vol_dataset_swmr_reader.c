@@ -0,0 +1,207 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * The reader side of the dataset flush and refresh benchmark in
+ * vol_dataset_test.c. The benchmark launches this program as a separate
+ * process, so that the reader has its own view of the file rather than
+ * sharing the writer's open file within one process.
+ *
+ * Usage: h5vl_test_swmr_reader <file> <num datasets> <elements per append>
+ *                              <num appends> <go fd> <ack fd>
+ *
+ * Once signalled by the writer over the 'go' pipe, the reader opens the
+ * file for SWMR reading and sends an acknowledgement over the 'ack' pipe.
+ * Then, for each append made by the writer, it refreshes the datasets
+ * until their new extent is visible, reads and verifies the newly-appended
+ * data and sends the time at which it finished back to the writer.
+ */
+
+#include "vol_dataset_test.h"
+
+/*
+ * Returns the current time in seconds from the same system-wide
+ * monotonic clock as get_wall_time(), so that times taken here can
+ * be compared with those taken by the writer process.
+ */
+static double
+swmr_reader_time(void)
+{
+    struct timespec ts;
+
+    if (HDclock_gettime(CLOCK_MONOTONIC, &ts) < 0)
+        return 0.0;
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1.0E9;
+}
+
+static int
+swmr_reader_run(const char *filename, size_t num_dsets, size_t step_size, size_t num_steps, int go_fd,
+                int ack_fd)
+{
+    hsize_t dims[1]  = {0};
+    hsize_t start[1] = {0};
+    hsize_t count[1] = {0};
+    size_t  i, j, k;
+    double  msg;
+    hid_t   file_id   = H5I_INVALID_HID;
+    hid_t   fspace_id = H5I_INVALID_HID;
+    hid_t   mspace_id = H5I_INVALID_HID;
+    hid_t  *dset_ids  = NULL;
+    char    dset_name[64];
+    int    *rbuf      = NULL;
+    int     ret_value = -1;
+
+    if (HDread(go_fd, &msg, sizeof(msg)) != sizeof(msg))
+        goto done;
+
+    if (NULL == (dset_ids = HDmalloc(num_dsets * sizeof(*dset_ids)))) {
+        HDprintf("    reader couldn't allocate dataset ID array\n");
+        goto done;
+    }
+    for (i = 0; i < num_dsets; i++)
+        dset_ids[i] = H5I_INVALID_HID;
+
+    if (NULL == (rbuf = HDmalloc(step_size * sizeof(*rbuf)))) {
+        HDprintf("    reader couldn't allocate buffer for dataset read\n");
+        goto done;
+    }
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY | H5F_ACC_SWMR_READ, H5P_DEFAULT)) < 0) {
+        HDprintf("    reader couldn't open file '%s'\n", filename);
+        goto done;
+    }
+
+    for (i = 0; i < num_dsets; i++) {
+        HDsnprintf(dset_name, sizeof(dset_name), "%s%zu", DATASET_FLUSH_REFRESH_BENCH_DSET_NAME_PREFIX, i);
+
+        if ((dset_ids[i] = H5Dopen2(file_id, dset_name, H5P_DEFAULT)) < 0) {
+            HDprintf("    reader couldn't open dataset '%s'\n", dset_name);
+            goto done;
+        }
+    }
+
+    count[0] = (hsize_t)step_size;
+
+    if ((mspace_id = H5Screate_simple(1, count, NULL)) < 0)
+        goto done;
+
+    msg = 0.0;
+    if (HDwrite(ack_fd, &msg, sizeof(msg)) != sizeof(msg))
+        goto done;
+
+    for (i = 0; i < num_steps; i++) {
+        double deadline = swmr_reader_time() + DATASET_FLUSH_REFRESH_BENCH_TIMEOUT;
+
+        start[0] = (hsize_t)(i * step_size);
+
+        for (j = 0; j < num_dsets; j++) {
+            /* Refresh the dataset until the writer's latest append is visible */
+            do {
+                if (swmr_reader_time() > deadline) {
+                    HDprintf("    reader timed out waiting for append %zu to dataset %zu\n", i, j);
+                    goto done;
+                }
+
+                if (H5Drefresh(dset_ids[j]) < 0) {
+                    HDprintf("    reader couldn't refresh dataset %zu\n", j);
+                    goto done;
+                }
+
+                if ((fspace_id = H5Dget_space(dset_ids[j])) < 0) {
+                    HDprintf("    reader failed to retrieve dataspace of dataset %zu\n", j);
+                    goto done;
+                }
+
+                if (H5Sget_simple_extent_dims(fspace_id, dims, NULL) < 0) {
+                    HDprintf("    reader failed to retrieve dimensions of dataset %zu\n", j);
+                    goto done;
+                }
+
+                if (dims[0] < start[0] + count[0]) {
+                    if (H5Sclose(fspace_id) < 0)
+                        goto done;
+                    fspace_id = H5I_INVALID_HID;
+                }
+            } while (fspace_id == H5I_INVALID_HID);
+
+            if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0) {
+                HDprintf("    reader couldn't select hyperslab\n");
+                goto done;
+            }
+
+            if (H5Dread(dset_ids[j], H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT, rbuf) < 0) {
+                HDprintf("    reader couldn't read from dataset %zu\n", j);
+                goto done;
+            }
+
+            for (k = 0; k < step_size; k++) {
+                if (rbuf[k] != (int)(start[0] + k + j)) {
+                    HDprintf("    reader data verification failed for append %zu to dataset %zu\n", i, j);
+                    goto done;
+                }
+            }
+
+            if (H5Sclose(fspace_id) < 0)
+                goto done;
+            fspace_id = H5I_INVALID_HID;
+        }
+
+        msg = swmr_reader_time();
+        if (HDwrite(ack_fd, &msg, sizeof(msg)) != sizeof(msg))
+            goto done;
+    }
+
+    ret_value = 0;
+
+done:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        if (dset_ids)
+            for (i = 0; i < num_dsets; i++)
+                H5Dclose(dset_ids[i]);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    HDfree(rbuf);
+    HDfree(dset_ids);
+
+    return ret_value;
+}
+
+int
+main(int argc, char **argv)
+{
+    int ret;
+
+    if (argc != 7) {
+        HDfprintf(stderr,
+                  "Usage: %s <file> <num datasets> <elements per append> <num appends> <go fd> <ack fd>\n",
+                  argv[0]);
+        HDexit(EXIT_FAILURE);
+    }
+
+    H5open();
+
+    ret = swmr_reader_run(argv[1], (size_t)HDstrtoul(argv[2], NULL, 10), (size_t)HDstrtoul(argv[3], NULL, 10),
+                          (size_t)HDstrtoul(argv[4], NULL, 10), HDatoi(argv[5]), HDatoi(argv[6]));
+
+    HDclose(HDatoi(argv[5]));
+    HDclose(HDatoi(argv[6]));
+
+    H5close();
+
+    HDexit((ret < 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
@@ -67,15 +67,18 @@ static int test_dataset_string_encodings(void);
 static int test_dataset_builtin_type_conversion(void);
 static int test_dataset_real_to_int_conversion(void);
 static int test_dataset_compound_partial_io(void);
+static int test_dataset_compound_partial_io_benchmark(void);
 static int test_dataset_set_extent_chunked_unlimited(void);
 static int test_dataset_set_extent_chunked_fixed(void);
 static int test_dataset_set_extent_data(void);
 static int test_dataset_set_extent_double_handles(void);
 static int test_dataset_set_extent_invalid_params(void);
+static int test_dataset_append_benchmark(void);
 static int test_flush_dataset(void);
 static int test_flush_dataset_invalid_params(void);
 static int test_refresh_dataset(void);
 static int test_refresh_dataset_invalid_params(void);
+static int test_dataset_flush_refresh_benchmark(void);
 
 /*
  * Chunking tests
@@ -92,6 +95,57 @@ static int test_read_partial_chunk_hyperslab_selection(void);
 static int test_read_partial_chunk_point_selection(void);
 
 static int test_get_vlen_buf_size(void);
+static int test_dataset_vlen_io_benchmark(void);
+
+/*
+ * The kinds of data and the element length distributions
+ * used by the variable-length data I/O benchmark.
+ */
+typedef enum dataset_vlen_bench_kind_t {
+    DATASET_VLEN_BENCH_FIXED_STRING,
+    DATASET_VLEN_BENCH_VLEN_STRING,
+    DATASET_VLEN_BENCH_VLEN_SEQUENCE
+} dataset_vlen_bench_kind_t;
+
+typedef enum dataset_vlen_bench_dist_t {
+    DATASET_VLEN_BENCH_DIST_FIXED,
+    DATASET_VLEN_BENCH_DIST_UNIFORM,
+    DATASET_VLEN_BENCH_DIST_HEAVY_TAILED
+} dataset_vlen_bench_dist_t;
+
+typedef struct dataset_vlen_bench_times_t {
+    double write;
+    double get_buf_size;
+    double read;
+    double reclaim;
+    double read_custom;
+    double reclaim_custom;
+    size_t nbytes;
+} dataset_vlen_bench_times_t;
+
+static int  dataset_compound_partial_io_bench_read(hid_t dset_id, hid_t file_type_id, size_t num_selected,
+                                                   hbool_t reorder, const unsigned char *wbuf,
+                                                   unsigned char *rbuf, double *time_out, size_t *nbytes_out);
+static void dataset_compound_partial_io_bench_report(size_t nbytes, double read_time, double full_read_time);
+static size_t dataset_vlen_bench_gen_length(dataset_vlen_bench_dist_t dist);
+static void  *dataset_vlen_bench_alloc(size_t size, void *mem_used);
+static void   dataset_vlen_bench_free(void *_mem, void *mem_used);
+static int    dataset_vlen_bench_verify(dataset_vlen_bench_kind_t kind, const size_t *lengths, const void *rbuf);
+static int    dataset_vlen_bench_run(hid_t group_id, const char *dset_name, dataset_vlen_bench_kind_t kind,
+                                     dataset_vlen_bench_dist_t dist, dataset_vlen_bench_times_t *times);
+static void   dataset_vlen_bench_report(dataset_vlen_bench_kind_t kind, const dataset_vlen_bench_times_t *times);
+static int    dataset_append_bench_run(const char *filename, hsize_t chunk_size, size_t batch_size,
+                                       double *extent_timings, double *write_timings, double *total_time_out,
+                                       hsize_t *file_size_out);
+static void   dataset_append_bench_report(size_t batch_size, size_t num_appends, double *extent_timings,
+                                          double *write_timings, double total_time, hsize_t file_size);
+#if defined(H5_HAVE_FORK) && defined(H5_HAVE_WAITPID) && defined(H5VL_TEST_SWMR_READER)
+static int  dataset_flush_refresh_bench_run(const char *filename, size_t num_dsets, size_t step_size,
+                                            double *flush_timings, double *latency_timings,
+                                            double *write_time_out);
+static void dataset_flush_refresh_bench_report(size_t num_dsets, size_t step_size, double *flush_timings,
+                                               double *latency_timings, double write_time);
+#endif
 
 /*
  * The array of dataset tests to be performed.
@@ -148,15 +202,18 @@ static int (*dataset_tests[])(void) = {
     test_dataset_builtin_type_conversion,
     test_dataset_real_to_int_conversion,
     test_dataset_compound_partial_io,
+    test_dataset_compound_partial_io_benchmark,
     test_dataset_set_extent_chunked_unlimited,
     test_dataset_set_extent_chunked_fixed,
     test_dataset_set_extent_data,
     test_dataset_set_extent_double_handles,
     test_dataset_set_extent_invalid_params,
+    test_dataset_append_benchmark,
     test_flush_dataset,
     test_flush_dataset_invalid_params,
     test_refresh_dataset,
     test_refresh_dataset_invalid_params,
+    test_dataset_flush_refresh_benchmark,
     test_create_single_chunk_dataset,
     test_write_single_chunk_dataset,
     test_create_multi_chunk_dataset,
@@ -168,6 +225,7 @@ static int (*dataset_tests[])(void) = {
     test_read_partial_chunk_hyperslab_selection,
     test_read_partial_chunk_point_selection,
     test_get_vlen_buf_size,
+    test_dataset_vlen_io_benchmark,
 };
 
 /*
@@ -10060,6 +10118,487 @@ error:
     return 1;
 }
 
+/*
+ * A benchmark to measure the cost of reading a subset of the members
+ * of a wide compound type, as is common for table-like data where only
+ * a few fields of each record are needed. The dataset's compound type
+ * contains many members of mixed sizes, generated in the same manner as
+ * the random compound types used elsewhere in these tests. A single
+ * member, ten percent of the members and all of the members are read,
+ * both with a memory type that matches the file layout and with a memory
+ * type that packs the selected members in reverse order.
+ */
+static int
+test_dataset_compound_partial_io_benchmark(void)
+{
+    hsize_t        dims[1] = {DATASET_COMPOUND_PARTIAL_IO_BENCH_DSET_DIMS};
+    size_t         i;
+    size_t         type_size      = 0;
+    size_t         tenth_members  = 0;
+    size_t         nbytes         = 0;
+    double         start_time     = 0.0;
+    double         write_time     = 0.0;
+    double         read_time      = 0.0;
+    double         full_read_time = 0.0;
+    hid_t          file_id        = H5I_INVALID_HID;
+    hid_t          container_group = H5I_INVALID_HID, group_id = H5I_INVALID_HID;
+    hid_t          dset_id      = H5I_INVALID_HID;
+    hid_t          space_id     = H5I_INVALID_HID;
+    hid_t          full_type_id = H5I_INVALID_HID;
+    hid_t          member_type  = H5I_INVALID_HID;
+    unsigned char *wbuf         = NULL;
+    unsigned char *rbuf         = NULL;
+
+    TESTING_MULTIPART("compound partial I/O benchmark with wide compound types");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC)) {
+        SKIPPED();
+        HDprintf(
+            "    API functions for basic file, group, or dataset aren't supported with this connector\n");
+        return 0;
+    }
+
+    TESTING_2("test setup");
+
+    if ((file_id = H5Fopen(vol_test_filename, H5F_ACC_RDWR, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open file '%s'\n", vol_test_filename);
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open container group '%s'\n", DATASET_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((group_id = H5Gcreate2(container_group, DATASET_COMPOUND_PARTIAL_IO_BENCH_GROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create container sub-group '%s'\n",
+                 DATASET_COMPOUND_PARTIAL_IO_BENCH_GROUP_NAME);
+        goto error;
+    }
+
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+
+    if ((full_type_id = H5Tcreate(H5T_COMPOUND, 1)) < 0)
+        TEST_ERROR;
+
+    /*
+     * Build the wide compound type one member at a time. Members with large
+     * type descriptions are rerolled so that the full compound type still
+     * fits within a native object header message.
+     */
+    for (i = 0; i < DATASET_COMPOUND_PARTIAL_IO_BENCH_NUM_MEMBERS; i++) {
+        size_t member_size;
+        size_t enc_size;
+        char   member_name[64];
+
+        do {
+            if (member_type >= 0 && H5Tclose(member_type) < 0)
+                TEST_ERROR;
+
+            if ((member_type = generate_random_datatype(H5T_NO_CLASS, TRUE)) < 0) {
+                H5_FAILED();
+                HDprintf("    couldn't create compound datatype member %zu\n", i);
+                goto error;
+            }
+
+            enc_size = 0;
+            if (H5Tencode(member_type, NULL, &enc_size) < 0) {
+                H5_FAILED();
+                HDprintf("    couldn't get encoded size of compound datatype member %zu\n", i);
+                goto error;
+            }
+        } while (enc_size > DATASET_COMPOUND_PARTIAL_IO_BENCH_MAX_MEMBER_ENC_SIZE);
+
+        if (0 == (member_size = H5Tget_size(member_type)))
+            TEST_ERROR;
+
+        HDsnprintf(member_name, sizeof(member_name), "member%zu", i);
+
+        if (H5Tset_size(full_type_id, type_size + member_size) < 0)
+            TEST_ERROR;
+        if (H5Tinsert(full_type_id, member_name, type_size, member_type) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't insert compound datatype member %zu\n", i);
+            goto error;
+        }
+
+        type_size += member_size;
+
+        if (H5Tclose(member_type) < 0)
+            TEST_ERROR;
+        member_type = H5I_INVALID_HID;
+    }
+
+    if ((dset_id = H5Dcreate2(group_id, DATASET_COMPOUND_PARTIAL_IO_BENCH_DSET_NAME, full_type_id, space_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create dataset '%s'\n", DATASET_COMPOUND_PARTIAL_IO_BENCH_DSET_NAME);
+        goto error;
+    }
+
+    if (NULL == (wbuf = HDmalloc(DATASET_COMPOUND_PARTIAL_IO_BENCH_DSET_DIMS * type_size)))
+        TEST_ERROR;
+    if (NULL == (rbuf = HDmalloc(DATASET_COMPOUND_PARTIAL_IO_BENCH_DSET_DIMS * type_size)))
+        TEST_ERROR;
+
+    /*
+     * Fill the records with a byte pattern rather than typed values. Since the
+     * memory types below only use the file's own member types, no member-level
+     * conversion takes place and the pattern is returned as-is.
+     */
+    for (i = 0; i < DATASET_COMPOUND_PARTIAL_IO_BENCH_DSET_DIMS * type_size; i++)
+        wbuf[i] = (unsigned char)(i % 251);
+
+    start_time = get_wall_time();
+
+    if (H5Dwrite(dset_id, full_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't write to dataset '%s'\n", DATASET_COMPOUND_PARTIAL_IO_BENCH_DSET_NAME);
+        goto error;
+    }
+
+    write_time = get_wall_time() - start_time;
+
+    PASSED();
+
+    HDprintf("    %d members, %zu bytes per record, %zu records; full write took %.6f s\n",
+             DATASET_COMPOUND_PARTIAL_IO_BENCH_NUM_MEMBERS, type_size,
+             (size_t)DATASET_COMPOUND_PARTIAL_IO_BENCH_DSET_DIMS, write_time);
+
+    tenth_members = MAX(DATASET_COMPOUND_PARTIAL_IO_BENCH_NUM_MEMBERS / 10, 1);
+
+    BEGIN_MULTIPART
+    {
+        PART_BEGIN(read_all_members_matching)
+        {
+            TESTING_2("H5Dread of all members with matching memory layout");
+
+            if (dataset_compound_partial_io_bench_read(dset_id, full_type_id,
+                                                       DATASET_COMPOUND_PARTIAL_IO_BENCH_NUM_MEMBERS, FALSE,
+                                                       wbuf, rbuf, &full_read_time, &nbytes) < 0)
+                PART_TEST_ERROR(read_all_members_matching);
+
+            PASSED();
+
+            dataset_compound_partial_io_bench_report(nbytes, full_read_time, full_read_time);
+        }
+        PART_END(read_all_members_matching);
+
+        PART_BEGIN(read_all_members_reordered)
+        {
+            TESTING_2("H5Dread of all members with reordered memory layout");
+
+            if (dataset_compound_partial_io_bench_read(dset_id, full_type_id,
+                                                       DATASET_COMPOUND_PARTIAL_IO_BENCH_NUM_MEMBERS, TRUE,
+                                                       wbuf, rbuf, &read_time, &nbytes) < 0)
+                PART_TEST_ERROR(read_all_members_reordered);
+
+            PASSED();
+
+            dataset_compound_partial_io_bench_report(nbytes, read_time, full_read_time);
+        }
+        PART_END(read_all_members_reordered);
+
+        PART_BEGIN(read_tenth_members_matching)
+        {
+            TESTING_2("H5Dread of 10% of members with matching memory layout");
+
+            if (dataset_compound_partial_io_bench_read(dset_id, full_type_id, tenth_members, FALSE, wbuf,
+                                                       rbuf, &read_time, &nbytes) < 0)
+                PART_TEST_ERROR(read_tenth_members_matching);
+
+            PASSED();
+
+            dataset_compound_partial_io_bench_report(nbytes, read_time, full_read_time);
+        }
+        PART_END(read_tenth_members_matching);
+
+        PART_BEGIN(read_tenth_members_reordered)
+        {
+            TESTING_2("H5Dread of 10% of members with reordered memory layout");
+
+            if (dataset_compound_partial_io_bench_read(dset_id, full_type_id, tenth_members, TRUE, wbuf, rbuf,
+                                                       &read_time, &nbytes) < 0)
+                PART_TEST_ERROR(read_tenth_members_reordered);
+
+            PASSED();
+
+            dataset_compound_partial_io_bench_report(nbytes, read_time, full_read_time);
+        }
+        PART_END(read_tenth_members_reordered);
+
+        PART_BEGIN(read_one_member_matching)
+        {
+            TESTING_2("H5Dread of a single member with matching memory layout");
+
+            if (dataset_compound_partial_io_bench_read(dset_id, full_type_id, 1, FALSE, wbuf, rbuf,
+                                                       &read_time, &nbytes) < 0)
+                PART_TEST_ERROR(read_one_member_matching);
+
+            PASSED();
+
+            dataset_compound_partial_io_bench_report(nbytes, read_time, full_read_time);
+        }
+        PART_END(read_one_member_matching);
+
+        PART_BEGIN(read_one_member_reordered)
+        {
+            TESTING_2("H5Dread of a single member with reordered memory layout");
+
+            if (dataset_compound_partial_io_bench_read(dset_id, full_type_id, 1, TRUE, wbuf, rbuf, &read_time,
+                                                       &nbytes) < 0)
+                PART_TEST_ERROR(read_one_member_reordered);
+
+            PASSED();
+
+            dataset_compound_partial_io_bench_report(nbytes, read_time, full_read_time);
+        }
+        PART_END(read_one_member_reordered);
+    }
+    END_MULTIPART;
+
+    TESTING_2("test cleanup");
+
+    HDfree(wbuf);
+    wbuf = NULL;
+    HDfree(rbuf);
+    rbuf = NULL;
+
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+    if (H5Tclose(full_type_id) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        HDfree(wbuf);
+        HDfree(rbuf);
+        H5Tclose(member_type);
+        H5Tclose(full_type_id);
+        H5Sclose(space_id);
+        H5Dclose(dset_id);
+        H5Gclose(group_id);
+        H5Gclose(container_group);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+/*
+ * Helper for the compound partial I/O benchmark which reads a subset
+ * of the members of the dataset's compound type and verifies the result.
+ * The selected members are spread evenly across the record. When 'reorder'
+ * is FALSE, each member is kept at its file offset within a memory record
+ * of the same size as the file record; otherwise, the selected members are
+ * packed together in reverse order. Returns the average time of a read
+ * and the number of bytes of each record that were selected.
+ */
+static int
+dataset_compound_partial_io_bench_read(hid_t dset_id, hid_t file_type_id, size_t num_selected, hbool_t reorder,
+                                       const unsigned char *wbuf, unsigned char *rbuf, double *time_out,
+                                       size_t *nbytes_out)
+{
+    unsigned *selected       = NULL;
+    hbool_t  *is_selected    = NULL;
+    size_t   *mem_offsets    = NULL;
+    size_t   *member_sizes   = NULL;
+    size_t    file_type_size = 0;
+    size_t    mem_type_size  = 0;
+    size_t    nbytes         = 0;
+    size_t    i, j, k;
+    double    start_time;
+    double    elapsed     = 0.0;
+    hid_t     mem_type_id = H5I_INVALID_HID;
+    hid_t     member_type = H5I_INVALID_HID;
+    char     *member_name = NULL;
+    int       num_members;
+    int       ret_value = -1;
+
+    if ((num_members = H5Tget_nmembers(file_type_id)) <= 0) {
+        HDprintf("    couldn't get number of compound datatype members\n");
+        goto done;
+    }
+    if (0 == (file_type_size = H5Tget_size(file_type_id))) {
+        HDprintf("    couldn't get compound datatype size\n");
+        goto done;
+    }
+
+    if (NULL == (selected = HDmalloc(num_selected * sizeof(*selected))) ||
+        NULL == (mem_offsets = HDmalloc(num_selected * sizeof(*mem_offsets))) ||
+        NULL == (member_sizes = HDmalloc(num_selected * sizeof(*member_sizes))) ||
+        NULL == (is_selected = HDcalloc((size_t)num_members, sizeof(*is_selected)))) {
+        HDprintf("    couldn't allocate member selection buffers\n");
+        goto done;
+    }
+
+    for (i = 0; i < num_selected; i++) {
+        selected[i]              = (unsigned)((i * (size_t)num_members) / num_selected);
+        is_selected[selected[i]] = TRUE;
+    }
+
+    /* Determine the memory offset of each selected member */
+    if (reorder) {
+        for (i = num_selected; i > 0; i--) {
+            if ((member_type = H5Tget_member_type(file_type_id, selected[i - 1])) < 0) {
+                HDprintf("    couldn't get type of compound datatype member %u\n", selected[i - 1]);
+                goto done;
+            }
+
+            mem_offsets[i - 1] = mem_type_size;
+            mem_type_size += H5Tget_size(member_type);
+
+            if (H5Tclose(member_type) < 0) {
+                HDprintf("    couldn't close compound datatype member type\n");
+                goto done;
+            }
+            member_type = H5I_INVALID_HID;
+        }
+    }
+    else {
+        for (i = 0; i < num_selected; i++)
+            mem_offsets[i] = H5Tget_member_offset(file_type_id, selected[i]);
+        mem_type_size = file_type_size;
+    }
+
+    if ((mem_type_id = H5Tcreate(H5T_COMPOUND, mem_type_size)) < 0) {
+        HDprintf("    couldn't create memory compound datatype\n");
+        goto done;
+    }
+
+    for (i = 0; i < num_selected; i++) {
+        if (NULL == (member_name = H5Tget_member_name(file_type_id, selected[i]))) {
+            HDprintf("    couldn't get name of compound datatype member %u\n", selected[i]);
+            goto done;
+        }
+        if ((member_type = H5Tget_member_type(file_type_id, selected[i])) < 0) {
+            HDprintf("    couldn't get type of compound datatype member %u\n", selected[i]);
+            goto done;
+        }
+
+        if (H5Tinsert(mem_type_id, member_name, mem_offsets[i], member_type) < 0) {
+            HDprintf("    couldn't insert member '%s' into memory compound datatype\n", member_name);
+            goto done;
+        }
+
+        member_sizes[i] = H5Tget_size(member_type);
+        nbytes += member_sizes[i];
+
+        H5free_memory(member_name);
+        member_name = NULL;
+        if (H5Tclose(member_type) < 0) {
+            HDprintf("    couldn't close compound datatype member type\n");
+            goto done;
+        }
+        member_type = H5I_INVALID_HID;
+    }
+
+    for (i = 0; i < DATASET_COMPOUND_PARTIAL_IO_BENCH_NUM_ITERS; i++) {
+        /* Fill rbuf so that untouched bytes can be detected */
+        HDmemset(rbuf, 0xFF, DATASET_COMPOUND_PARTIAL_IO_BENCH_DSET_DIMS * file_type_size);
+
+        start_time = get_wall_time();
+
+        if (H5Dread(dset_id, mem_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) {
+            HDprintf("    couldn't read from dataset\n");
+            goto done;
+        }
+
+        elapsed += get_wall_time() - start_time;
+    }
+
+    /* Verify the selected members and, for the matching layout, that the other members were untouched */
+    for (i = 0; i < DATASET_COMPOUND_PARTIAL_IO_BENCH_DSET_DIMS; i++) {
+        const unsigned char *file_rec = wbuf + (i * file_type_size);
+        const unsigned char *mem_rec  = rbuf + (i * mem_type_size);
+
+        if (reorder) {
+            for (j = 0; j < num_selected; j++) {
+                size_t file_offset = H5Tget_member_offset(file_type_id, selected[j]);
+
+                if (HDmemcmp(mem_rec + mem_offsets[j], file_rec + file_offset, member_sizes[j])) {
+                    HDprintf("    data verification failed for record %zu, member %u\n", i, selected[j]);
+                    goto done;
+                }
+            }
+        }
+        else {
+            for (j = 0; j < (size_t)num_members; j++) {
+                size_t member_start = H5Tget_member_offset(file_type_id, (unsigned)j);
+                size_t member_end   = (j < (size_t)num_members - 1)
+                                          ? H5Tget_member_offset(file_type_id, (unsigned)(j + 1))
+                                          : file_type_size;
+
+                for (k = member_start; k < member_end; k++) {
+                    unsigned char expected = is_selected[j] ? file_rec[k] : 0xFF;
+
+                    if (mem_rec[k] != expected) {
+                        HDprintf("    data verification failed for record %zu, member %zu\n", i, j);
+                        goto done;
+                    }
+                }
+            }
+        }
+    }
+
+    *time_out   = elapsed / DATASET_COMPOUND_PARTIAL_IO_BENCH_NUM_ITERS;
+    *nbytes_out = nbytes;
+
+    ret_value = 0;
+
+done:
+    H5free_memory(member_name);
+
+    H5E_BEGIN_TRY
+    {
+        H5Tclose(member_type);
+        H5Tclose(mem_type_id);
+    }
+    H5E_END_TRY;
+
+    HDfree(selected);
+    HDfree(is_selected);
+    HDfree(mem_offsets);
+    HDfree(member_sizes);
+
+    return ret_value;
+}
+
+/*
+ * Prints the result of a single read from the compound partial I/O
+ * benchmark, relative to the time taken to read all of the members.
+ */
+static void
+dataset_compound_partial_io_bench_report(size_t nbytes, double read_time, double full_read_time)
+{
+    double mbytes = (double)(nbytes * DATASET_COMPOUND_PARTIAL_IO_BENCH_DSET_DIMS) / (1024.0 * 1024.0);
+
+    HDprintf("    %zu bytes per record selected: %.6f s per read, %.2f MiB/s, %.1f%% of full read time\n",
+             nbytes, read_time, (read_time > 0.0) ? mbytes / read_time : 0.0,
+             (full_read_time > 0.0) ? 100.0 * read_time / full_read_time : 0.0);
+}
+
 /*
  * A test to check that a chunked dataset's extent can be
  * changed by using H5Dset_extent. This test uses unlimited
@@ -11333,23 +11872,320 @@ error:
 } /* test_dataset_set_extent_invalid_params */
 
 /*
- * A test for H5Dflush.
+ * A benchmark to measure the cost of appending records to a chunked
+ * dataset with an unlimited dimension, as is common for time-series
+ * data. Records are appended in batches by extending the dataset with
+ * H5Dset_extent and then writing the new records with a hyperslab
+ * selection. This is repeated for several chunk sizes and batch sizes,
+ * reporting the sustained append rate, the latency distribution of the
+ * H5Dset_extent and H5Dwrite calls and the final size of the file.
  */
 static int
-test_flush_dataset(void)
+test_dataset_append_benchmark(void)
 {
-    TESTING("H5Dflush");
+    hsize_t chunk_sizes[] = DATASET_APPEND_BENCH_CHUNK_SIZES;
+    hsize_t file_size     = 0;
+    size_t  batch_sizes[] = DATASET_APPEND_BENCH_BATCH_SIZES;
+    size_t  i, j;
+    double  total_time        = 0.0;
+    double *extent_timings    = NULL;
+    double *write_timings     = NULL;
+    char   *prefixed_filename = NULL;
 
-    SKIPPED();
+    TESTING_MULTIPART("append-heavy time-series benchmark with H5Dset_extent");
 
-    return 0;
-}
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_MORE) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_MORE)) {
+        SKIPPED();
+        HDprintf("    API functions for basic or more file, basic or more dataset aren't supported with this "
+                 "connector\n");
+        return 0;
+    }
 
-/*
- * A test to check that H5Dflush fails when it is
- * passed invalid parameters.
- */
-static int
+    TESTING_2("test setup");
+
+    if (prefix_filename(test_path_prefix, DATASET_APPEND_BENCH_FILE_NAME, &prefixed_filename) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't prefix filename\n");
+        goto error;
+    }
+
+    /* Appending a single record at a time requires the most timing slots */
+    if (NULL == (extent_timings = HDmalloc(DATASET_APPEND_BENCH_NUM_RECORDS * sizeof(*extent_timings))))
+        TEST_ERROR;
+    if (NULL == (write_timings = HDmalloc(DATASET_APPEND_BENCH_NUM_RECORDS * sizeof(*write_timings))))
+        TEST_ERROR;
+
+    PASSED();
+
+    BEGIN_MULTIPART
+    {
+        for (i = 0; i < ARRAY_LENGTH(chunk_sizes); i++) {
+            for (j = 0; j < ARRAY_LENGTH(batch_sizes); j++) {
+                PART_BEGIN(append_records)
+                {
+                    char test_name[128];
+
+                    HDsnprintf(test_name, sizeof(test_name), "appends of %zu record(s) with chunk size %llu",
+                               batch_sizes[j], (unsigned long long)chunk_sizes[i]);
+
+                    TESTING_2(test_name);
+
+                    if (dataset_append_bench_run(prefixed_filename, chunk_sizes[i], batch_sizes[j],
+                                                 extent_timings, write_timings, &total_time, &file_size) < 0)
+                        PART_TEST_ERROR(append_records);
+
+                    PASSED();
+
+                    dataset_append_bench_report(batch_sizes[j],
+                                                (DATASET_APPEND_BENCH_NUM_RECORDS + batch_sizes[j] - 1) /
+                                                    batch_sizes[j],
+                                                extent_timings, write_timings, total_time, file_size);
+                }
+                PART_END(append_records);
+            }
+        }
+    }
+    END_MULTIPART;
+
+    TESTING_2("test cleanup");
+
+    HDfree(extent_timings);
+    extent_timings = NULL;
+    HDfree(write_timings);
+    write_timings = NULL;
+
+    HDfree(prefixed_filename);
+    prefixed_filename = NULL;
+
+    remove_test_file(test_path_prefix, DATASET_APPEND_BENCH_FILE_NAME);
+
+    PASSED();
+
+    return 0;
+
+error:
+    HDfree(extent_timings);
+    HDfree(write_timings);
+    HDfree(prefixed_filename);
+
+    return 1;
+}
+
+/*
+ * Helper for the append benchmark which creates a new file containing an
+ * empty chunked dataset and appends DATASET_APPEND_BENCH_NUM_RECORDS
+ * records to it in batches of 'batch_size' records. The time taken by
+ * each H5Dset_extent and H5Dwrite call is stored in 'extent_timings' and
+ * 'write_timings', respectively. After appending, the records are read
+ * back and verified.
+ */
+static int
+dataset_append_bench_run(const char *filename, hsize_t chunk_size, size_t batch_size, double *extent_timings,
+                         double *write_timings, double *total_time_out, hsize_t *file_size_out)
+{
+    hsize_t dims[2]       = {0, DATASET_APPEND_BENCH_RECORD_LEN};
+    hsize_t max_dims[2]   = {H5S_UNLIMITED, DATASET_APPEND_BENCH_RECORD_LEN};
+    hsize_t chunk_dims[2] = {0, DATASET_APPEND_BENCH_RECORD_LEN};
+    hsize_t start[2]      = {0, 0};
+    hsize_t count[2]      = {0, DATASET_APPEND_BENCH_RECORD_LEN};
+    size_t  num_appends   = 0;
+    size_t  i;
+    double  start_time, append_start_time;
+    hid_t   file_id   = H5I_INVALID_HID;
+    hid_t   dset_id   = H5I_INVALID_HID;
+    hid_t   dcpl_id   = H5I_INVALID_HID;
+    hid_t   fspace_id = H5I_INVALID_HID;
+    hid_t   mspace_id = H5I_INVALID_HID;
+    int    *wbuf      = NULL;
+    int    *rbuf      = NULL;
+    int     ret_value = -1;
+
+    chunk_dims[0] = chunk_size;
+
+    if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        HDprintf("    couldn't create file '%s'\n", filename);
+        goto done;
+    }
+
+    if ((fspace_id = H5Screate_simple(2, dims, max_dims)) < 0)
+        goto done;
+
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto done;
+
+    if (H5Pset_chunk(dcpl_id, 2, chunk_dims) < 0) {
+        HDprintf("    unable to set dataset chunk dimensionality\n");
+        goto done;
+    }
+
+    if ((dset_id = H5Dcreate2(file_id, DATASET_APPEND_BENCH_DSET_NAME, H5T_NATIVE_INT, fspace_id, H5P_DEFAULT,
+                              dcpl_id, H5P_DEFAULT)) < 0) {
+        HDprintf("    couldn't create dataset '%s'\n", DATASET_APPEND_BENCH_DSET_NAME);
+        goto done;
+    }
+
+    if (H5Sclose(fspace_id) < 0)
+        goto done;
+    fspace_id = H5I_INVALID_HID;
+
+    if (NULL == (wbuf = HDmalloc(batch_size * DATASET_APPEND_BENCH_RECORD_LEN * sizeof(*wbuf)))) {
+        HDprintf("    couldn't allocate buffer for dataset write\n");
+        goto done;
+    }
+
+    start_time = get_wall_time();
+
+    while (dims[0] < DATASET_APPEND_BENCH_NUM_RECORDS) {
+        hsize_t nrecords = MIN(batch_size, DATASET_APPEND_BENCH_NUM_RECORDS - dims[0]);
+
+        for (i = 0; i < nrecords * DATASET_APPEND_BENCH_RECORD_LEN; i++)
+            wbuf[i] = (int)(dims[0] * DATASET_APPEND_BENCH_RECORD_LEN + i);
+
+        start[0] = dims[0];
+        count[0] = nrecords;
+        dims[0] += nrecords;
+
+        append_start_time = get_wall_time();
+
+        if (H5Dset_extent(dset_id, dims) < 0) {
+            HDprintf("    failed to extend dataset to %llu records\n", (unsigned long long)dims[0]);
+            goto done;
+        }
+
+        extent_timings[num_appends] = get_wall_time() - append_start_time;
+
+        append_start_time = get_wall_time();
+
+        if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+            HDprintf("    failed to retrieve dataset's dataspace\n");
+            goto done;
+        }
+
+        if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0) {
+            HDprintf("    couldn't select hyperslab for append\n");
+            goto done;
+        }
+
+        if ((mspace_id = H5Screate_simple(2, count, NULL)) < 0)
+            goto done;
+
+        if (H5Dwrite(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT, wbuf) < 0) {
+            HDprintf("    couldn't append %llu records to dataset\n", (unsigned long long)nrecords);
+            goto done;
+        }
+
+        write_timings[num_appends] = get_wall_time() - append_start_time;
+
+        if (H5Sclose(mspace_id) < 0)
+            goto done;
+        mspace_id = H5I_INVALID_HID;
+        if (H5Sclose(fspace_id) < 0)
+            goto done;
+        fspace_id = H5I_INVALID_HID;
+
+        num_appends++;
+    }
+
+    if (H5Fflush(file_id, H5F_SCOPE_LOCAL) < 0) {
+        HDprintf("    couldn't flush file '%s'\n", filename);
+        goto done;
+    }
+
+    *total_time_out = get_wall_time() - start_time;
+
+    if (H5Fget_filesize(file_id, file_size_out) < 0) {
+        HDprintf("    couldn't retrieve size of file '%s'\n", filename);
+        goto done;
+    }
+
+    if (NULL == (rbuf = HDmalloc((size_t)DATASET_APPEND_BENCH_NUM_RECORDS * DATASET_APPEND_BENCH_RECORD_LEN *
+                                 sizeof(*rbuf)))) {
+        HDprintf("    couldn't allocate buffer for dataset read\n");
+        goto done;
+    }
+
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) {
+        HDprintf("    couldn't read from dataset '%s'\n", DATASET_APPEND_BENCH_DSET_NAME);
+        goto done;
+    }
+
+    for (i = 0; i < DATASET_APPEND_BENCH_NUM_RECORDS * DATASET_APPEND_BENCH_RECORD_LEN; i++) {
+        if (rbuf[i] != (int)i) {
+            HDprintf("    data verification failed at record %zu\n", i / DATASET_APPEND_BENCH_RECORD_LEN);
+            goto done;
+        }
+    }
+
+    ret_value = 0;
+
+done:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Pclose(dcpl_id);
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    HDfree(rbuf);
+    HDfree(wbuf);
+
+    return ret_value;
+}
+
+/*
+ * Prints the sustained append rate and the latency percentiles
+ * from a single run of the append benchmark.
+ */
+static void
+dataset_append_bench_report(size_t batch_size, size_t num_appends, double *extent_timings,
+                            double *write_timings, double total_time, hsize_t file_size)
+{
+    size_t data_size =
+        (size_t)DATASET_APPEND_BENCH_NUM_RECORDS * DATASET_APPEND_BENCH_RECORD_LEN * sizeof(int);
+
+    sort_timings(extent_timings, num_appends);
+    sort_timings(write_timings, num_appends);
+
+    HDprintf("    %d records in %zu appends of %zu: %.6f s (%.0f records/s)\n",
+             DATASET_APPEND_BENCH_NUM_RECORDS, num_appends, batch_size, total_time,
+             (total_time > 0.0) ? (double)DATASET_APPEND_BENCH_NUM_RECORDS / total_time : 0.0);
+    HDprintf("    H5Dset_extent latency (us): p50 %.2f, p99 %.2f, p99.9 %.2f, max %.2f\n",
+             get_timing_percentile(extent_timings, num_appends, 50.0) * 1.0E6,
+             get_timing_percentile(extent_timings, num_appends, 99.0) * 1.0E6,
+             get_timing_percentile(extent_timings, num_appends, 99.9) * 1.0E6,
+             extent_timings[num_appends - 1] * 1.0E6);
+    HDprintf("    H5Dwrite latency (us): p50 %.2f, p99 %.2f, p99.9 %.2f, max %.2f\n",
+             get_timing_percentile(write_timings, num_appends, 50.0) * 1.0E6,
+             get_timing_percentile(write_timings, num_appends, 99.0) * 1.0E6,
+             get_timing_percentile(write_timings, num_appends, 99.9) * 1.0E6,
+             write_timings[num_appends - 1] * 1.0E6);
+    HDprintf("    file size: %llu bytes for %zu bytes of data (%.2fx)\n", (unsigned long long)file_size,
+             data_size, (double)file_size / (double)data_size);
+}
+
+/*
+ * A test for H5Dflush.
+ */
+static int
+test_flush_dataset(void)
+{
+    TESTING("H5Dflush");
+
+    SKIPPED();
+
+    return 0;
+}
+
+/*
+ * A test to check that H5Dflush fails when it is
+ * passed invalid parameters.
+ */
+static int
 test_flush_dataset_invalid_params(void)
 {
     TESTING("H5Dflush with invalid parameters");
@@ -11387,161 +12223,129 @@ test_refresh_dataset_invalid_params(void)
 }
 
 /*
- * A test to create a dataset composed of a single chunk.
+ * A benchmark to measure the cost of H5Dflush and H5Drefresh in a
+ * reader/writer pipeline, as used when monitoring a file while it is
+ * being written. A writer repeatedly appends data to a number of
+ * datasets and flushes them, while a separate reader process refreshes
+ * the datasets until the new data becomes visible and then reads it
+ * back. This is repeated for several dataset counts and amounts of data
+ * per append, reporting the cost of flushing and the end-to-end latency
+ * between the start of an append in the writer and the data being read
+ * in the reader. The file is opened for SWMR access so that the reader
+ * can see the writer's changes while the writer still has the file open,
+ * so the test is only run with the native connector. The reader is the
+ * h5vl_test_swmr_reader program, built alongside the tests.
  */
 static int
-test_create_single_chunk_dataset(void)
+test_dataset_flush_refresh_benchmark(void)
 {
-    hsize_t dims[DATASET_SINGLE_CHUNK_TEST_SPACE_RANK];
-    hsize_t retrieved_chunk_dims[DATASET_SINGLE_CHUNK_TEST_SPACE_RANK];
-    size_t  i;
-    hid_t   file_id         = H5I_INVALID_HID;
-    hid_t   container_group = H5I_INVALID_HID, group_id = H5I_INVALID_HID;
-    hid_t   dset_id    = H5I_INVALID_HID;
-    hid_t   dset_dtype = H5I_INVALID_HID;
-    hid_t   dcpl_id    = H5I_INVALID_HID;
-    hid_t   fspace_id  = H5I_INVALID_HID;
+#if defined(H5_HAVE_FORK) && defined(H5_HAVE_WAITPID) && defined(H5VL_TEST_SWMR_READER)
+    size_t  dset_counts[] = DATASET_FLUSH_REFRESH_BENCH_DSET_COUNTS;
+    size_t  step_sizes[]  = DATASET_FLUSH_REFRESH_BENCH_STEP_SIZES;
+    size_t  i, j;
+    hbool_t is_native_vol     = FALSE;
+    double  write_time        = 0.0;
+    double *flush_timings     = NULL;
+    double *latency_timings   = NULL;
+    char   *prefixed_filename = NULL;
+    hid_t   file_id           = H5I_INVALID_HID;
+#endif
 
-    TESTING("creation of dataset with single chunk");
+    TESTING_MULTIPART("flush and refresh latency benchmark with reader and writer processes");
 
+#if defined(H5_HAVE_FORK) && defined(H5_HAVE_WAITPID) && defined(H5VL_TEST_SWMR_READER)
     /* Make sure the connector supports the API functions being tested */
-    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
-        !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GET_PLIST)) {
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_MORE) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_MORE) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_FLUSH_REFRESH)) {
         SKIPPED();
-        HDprintf("    API functions for basic file, group, dataset, or get property list aren't supported "
-                 "with this connector\n");
+        HDprintf("    API functions for basic or more file, basic or more dataset, or flush/refresh aren't "
+                 "supported with this connector\n");
         return 0;
     }
 
-    if ((file_id = H5Fopen(vol_test_filename, H5F_ACC_RDWR, H5P_DEFAULT)) < 0) {
+    TESTING_2("test setup");
+
+    if (prefix_filename(test_path_prefix, DATASET_FLUSH_REFRESH_BENCH_FILE_NAME, &prefixed_filename) < 0) {
         H5_FAILED();
-        HDprintf("    couldn't open file '%s'\n", vol_test_filename);
+        HDprintf("    couldn't prefix filename\n");
         goto error;
     }
 
-    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+    /* SWMR access is only available through the native connector */
+    if ((file_id = H5Fcreate(prefixed_filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        HDprintf("    couldn't open container group '%s'\n", DATASET_TEST_GROUP_NAME);
+        HDprintf("    couldn't create file '%s'\n", prefixed_filename);
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, DATASET_SINGLE_CHUNK_TEST_GROUP_NAME, H5P_DEFAULT,
-                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+    if (H5VLobject_is_native(file_id, &is_native_vol) < 0) {
         H5_FAILED();
-        HDprintf("    couldn't create container sub-group '%s'\n", DATASET_SINGLE_CHUNK_TEST_GROUP_NAME);
+        HDprintf("    couldn't determine if connector is the native connector\n");
         goto error;
     }
 
-    if ((fspace_id = generate_random_dataspace(DATASET_SINGLE_CHUNK_TEST_SPACE_RANK, NULL, dims, FALSE)) < 0)
-        TEST_ERROR;
-    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS, FALSE)) < 0)
+    if (H5Fclose(file_id) < 0)
         TEST_ERROR;
+    file_id = H5I_INVALID_HID;
 
-    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
-        TEST_ERROR;
+    if (!is_native_vol) {
+        SKIPPED();
+        HDprintf("    SWMR access isn't supported with this connector\n");
 
-    if (H5Pset_chunk(dcpl_id, DATASET_SINGLE_CHUNK_TEST_SPACE_RANK, dims) < 0) {
-        H5_FAILED();
-        HDprintf("    failed to set chunking on DCPL\n");
-        goto error;
-    }
+        HDfree(prefixed_filename);
+        remove_test_file(test_path_prefix, DATASET_FLUSH_REFRESH_BENCH_FILE_NAME);
 
-    if ((dset_id = H5Dcreate2(group_id, DATASET_SINGLE_CHUNK_TEST_DSET_NAME, dset_dtype, fspace_id,
-                              H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        HDprintf("    couldn't create dataset '%s'\n", DATASET_SINGLE_CHUNK_TEST_DSET_NAME);
-        goto error;
+        return 0;
     }
 
-    /*
-     * See if a copy of the DCPL reports the correct chunking.
-     */
-    if (H5Pclose(dcpl_id) < 0) {
-        H5_FAILED();
-        HDprintf("    failed to close DCPL\n");
-        goto error;
-    }
+    if (NULL == (flush_timings = HDmalloc(DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS * sizeof(*flush_timings))))
+        TEST_ERROR;
+    if (NULL ==
+        (latency_timings = HDmalloc(DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS * sizeof(*latency_timings))))
+        TEST_ERROR;
 
-    if ((dcpl_id = H5Dget_create_plist(dset_id)) < 0) {
-        H5_FAILED();
-        HDprintf("    failed to retrieve copy of DCPL\n");
-        goto error;
-    }
+    PASSED();
 
-    memset(retrieved_chunk_dims, 0, sizeof(retrieved_chunk_dims));
-    if (H5Pget_chunk(dcpl_id, DATASET_SINGLE_CHUNK_TEST_SPACE_RANK, retrieved_chunk_dims) < 0) {
-        H5_FAILED();
-        HDprintf("    failed to retrieve chunking info\n");
-        goto error;
-    }
+    BEGIN_MULTIPART
+    {
+        for (i = 0; i < ARRAY_LENGTH(dset_counts); i++) {
+            for (j = 0; j < ARRAY_LENGTH(step_sizes); j++) {
+                PART_BEGIN(flush_refresh)
+                {
+                    char test_name[128];
 
-    for (i = 0; i < DATASET_SINGLE_CHUNK_TEST_SPACE_RANK; i++) {
-        if (dims[i] != retrieved_chunk_dims[i]) {
-            H5_FAILED();
-            HDprintf("    chunk dimensionality retrieved from DCPL didn't match originally specified "
-                     "dimensionality\n");
-            goto error;
-        }
-    }
+                    HDsnprintf(test_name, sizeof(test_name), "%zu dataset(s) with %zu elements per append",
+                               dset_counts[i], step_sizes[j]);
 
-    /*
-     * Now close the dataset and retrieve a copy
-     * of the DCPL after re-opening it.
-     */
-    if (H5Pclose(dcpl_id) < 0) {
-        H5_FAILED();
-        HDprintf("    failed to close DCPL\n");
-        goto error;
-    }
+                    TESTING_2(test_name);
 
-    if (H5Dclose(dset_id) < 0) {
-        H5_FAILED();
-        HDprintf("    failed to close dataset\n");
-        goto error;
-    }
+                    if (dataset_flush_refresh_bench_run(prefixed_filename, dset_counts[i], step_sizes[j],
+                                                        flush_timings, latency_timings, &write_time) < 0)
+                        PART_TEST_ERROR(flush_refresh);
 
-    if ((dset_id = H5Dopen2(group_id, DATASET_SINGLE_CHUNK_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
-        H5_FAILED();
-        HDprintf("    failed to re-open dataset\n");
-        goto error;
-    }
+                    PASSED();
 
-    if ((dcpl_id = H5Dget_create_plist(dset_id)) < 0) {
-        H5_FAILED();
-        HDprintf("    failed to retrieve copy of DCPL\n");
-        goto error;
+                    dataset_flush_refresh_bench_report(dset_counts[i], step_sizes[j], flush_timings,
+                                                       latency_timings, write_time);
+                }
+                PART_END(flush_refresh);
+            }
+        }
     }
+    END_MULTIPART;
 
-    memset(retrieved_chunk_dims, 0, sizeof(retrieved_chunk_dims));
-    if (H5Pget_chunk(dcpl_id, DATASET_SINGLE_CHUNK_TEST_SPACE_RANK, retrieved_chunk_dims) < 0) {
-        H5_FAILED();
-        HDprintf("    failed to retrieve chunking info\n");
-        goto error;
-    }
+    TESTING_2("test cleanup");
 
-    for (i = 0; i < DATASET_SINGLE_CHUNK_TEST_SPACE_RANK; i++) {
-        if (dims[i] != retrieved_chunk_dims[i]) {
-            H5_FAILED();
-            HDprintf("    chunk dimensionality retrieved from DCPL didn't match originally specified "
-                     "dimensionality\n");
-            goto error;
-        }
-    }
+    HDfree(flush_timings);
+    flush_timings = NULL;
+    HDfree(latency_timings);
+    latency_timings = NULL;
 
-    if (H5Pclose(dcpl_id) < 0)
-        TEST_ERROR;
-    if (H5Sclose(fspace_id) < 0)
-        TEST_ERROR;
-    if (H5Tclose(dset_dtype) < 0)
-        TEST_ERROR;
-    if (H5Dclose(dset_id) < 0)
-        TEST_ERROR;
-    if (H5Gclose(group_id) < 0)
-        TEST_ERROR;
-    if (H5Gclose(container_group) < 0)
-        TEST_ERROR;
-    if (H5Fclose(file_id) < 0)
-        TEST_ERROR;
+    HDfree(prefixed_filename);
+    prefixed_filename = NULL;
+
+    remove_test_file(test_path_prefix, DATASET_FLUSH_REFRESH_BENCH_FILE_NAME);
 
     PASSED();
 
@@ -11550,44 +12354,330 @@ test_create_single_chunk_dataset(void)
 error:
     H5E_BEGIN_TRY
     {
-        H5Pclose(dcpl_id);
-        H5Sclose(fspace_id);
-        H5Tclose(dset_dtype);
-        H5Dclose(dset_id);
-        H5Gclose(group_id);
-        H5Gclose(container_group);
         H5Fclose(file_id);
     }
     H5E_END_TRY;
 
+    HDfree(flush_timings);
+    HDfree(latency_timings);
+    HDfree(prefixed_filename);
+
     return 1;
+#else
+    SKIPPED();
+    HDprintf("    fork(), waitpid() and the SWMR reader program are needed for the reader process of this "
+             "test\n");
+
+    return 0;
+#endif
 }
 
+#if defined(H5_HAVE_FORK) && defined(H5_HAVE_WAITPID) && defined(H5VL_TEST_SWMR_READER)
 /*
- * A test to check that a single-chunk dataset can be written
- * and read correctly.
+ * Helper for the flush and refresh benchmark which launches the reader
+ * process and then acts as the writer. The writer creates a new file
+ * containing 'num_dsets' empty datasets, starts SWMR writing and then
+ * performs DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS appends of 'step_size'
+ * elements to each dataset, flushing each dataset after every append.
+ * After each append, the writer waits for the reader to report the time
+ * at which it finished reading the new data. The reader is started with
+ * fork() followed immediately by exec() of the reader program, so the
+ * new process doesn't inherit this process's library or connector state.
+ * The processes synchronize over a pair of pipes, so the file is only
+ * opened by the reader once SWMR writing has started.
  */
 static int
-test_write_single_chunk_dataset(void)
+dataset_flush_refresh_bench_run(const char *filename, size_t num_dsets, size_t step_size,
+                                double *flush_timings, double *latency_timings, double *write_time_out)
 {
-    hssize_t space_npoints;
-    hsize_t  dims[DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_SPACE_RANK];
-    hsize_t  retrieved_chunk_dims[DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_SPACE_RANK];
-    size_t   i, data_size;
-    hid_t    file_id         = H5I_INVALID_HID;
-    hid_t    container_group = H5I_INVALID_HID, group_id = H5I_INVALID_HID;
-    hid_t    dset_id   = H5I_INVALID_HID;
-    hid_t    dcpl_id   = H5I_INVALID_HID;
-    hid_t    fspace_id = H5I_INVALID_HID;
-    void    *write_buf = NULL;
-    void    *read_buf  = NULL;
+    hsize_t dims[1]       = {0};
+    hsize_t max_dims[1]   = {H5S_UNLIMITED};
+    hsize_t chunk_dims[1] = {0};
+    hsize_t start[1]      = {0};
+    hsize_t count[1]      = {0};
+    size_t  i, j;
+    double  start_time, ack_time;
+    hid_t   file_id   = H5I_INVALID_HID;
+    hid_t   fapl_id   = H5I_INVALID_HID;
+    hid_t   dcpl_id   = H5I_INVALID_HID;
+    hid_t   fspace_id = H5I_INVALID_HID;
+    hid_t   mspace_id = H5I_INVALID_HID;
+    hid_t  *dset_ids  = NULL;
+    pid_t   pid       = -1;
+    char    dset_name[64];
+    char    reader_args[5][32];
+    char   *reader_argv[8];
+    int     go_pipe[2]  = {-1, -1};
+    int     ack_pipe[2] = {-1, -1};
+    int    *wbuf        = NULL;
+    int     status;
+    int     ret_value = -1;
 
-    TESTING("write to dataset with single chunk");
+    *write_time_out = 0.0;
+
+    if (HDpipe(go_pipe) < 0 || HDpipe(ack_pipe) < 0) {
+        HDprintf("    couldn't create pipes for synchronizing with reader process\n");
+        goto done;
+    }
+
+    /* Build the reader's arguments up front, so the new process only has to exec */
+    HDsnprintf(reader_args[0], sizeof(reader_args[0]), "%zu", num_dsets);
+    HDsnprintf(reader_args[1], sizeof(reader_args[1]), "%zu", step_size);
+    HDsnprintf(reader_args[2], sizeof(reader_args[2]), "%d", DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS);
+    HDsnprintf(reader_args[3], sizeof(reader_args[3]), "%d", go_pipe[0]);
+    HDsnprintf(reader_args[4], sizeof(reader_args[4]), "%d", ack_pipe[1]);
+
+    reader_argv[0] = (char *)H5VL_TEST_SWMR_READER;
+    reader_argv[1] = (char *)filename;
+    for (i = 0; i < 5; i++)
+        reader_argv[i + 2] = reader_args[i];
+    reader_argv[7] = NULL;
+
+    /* Make sure buffered output isn't duplicated by the reader process */
+    HDfflush(stdout);
+
+    if ((pid = HDfork()) < 0) {
+        HDprintf("    couldn't fork reader process\n");
+        goto done;
+    }
+
+    if (pid == 0) {
+        HDclose(go_pipe[1]);
+        HDclose(ack_pipe[0]);
+
+        HDexecv(H5VL_TEST_SWMR_READER, reader_argv);
+
+        /* Only reached if the reader program couldn't be run */
+        HD_exit(EXIT_FAILURE);
+    }
+
+    HDclose(go_pipe[0]);
+    go_pipe[0] = -1;
+    HDclose(ack_pipe[1]);
+    ack_pipe[1] = -1;
+
+    if (NULL == (dset_ids = HDmalloc(num_dsets * sizeof(*dset_ids)))) {
+        HDprintf("    couldn't allocate dataset ID array\n");
+        goto done;
+    }
+    for (i = 0; i < num_dsets; i++)
+        dset_ids[i] = H5I_INVALID_HID;
+
+    if (NULL == (wbuf = HDmalloc(step_size * sizeof(*wbuf)))) {
+        HDprintf("    couldn't allocate buffer for dataset write\n");
+        goto done;
+    }
+
+    /* SWMR access requires the latest version of the file format */
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        goto done;
+    if (H5Pset_libver_bounds(fapl_id, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0) {
+        HDprintf("    couldn't set library version bounds\n");
+        goto done;
+    }
+
+    if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
+        HDprintf("    couldn't create file '%s'\n", filename);
+        goto done;
+    }
+
+    if ((fspace_id = H5Screate_simple(1, dims, max_dims)) < 0)
+        goto done;
+
+    chunk_dims[0] = (hsize_t)step_size;
+
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto done;
+    if (H5Pset_chunk(dcpl_id, 1, chunk_dims) < 0) {
+        HDprintf("    unable to set dataset chunk dimensionality\n");
+        goto done;
+    }
+
+    for (i = 0; i < num_dsets; i++) {
+        HDsnprintf(dset_name, sizeof(dset_name), "%s%zu", DATASET_FLUSH_REFRESH_BENCH_DSET_NAME_PREFIX, i);
+
+        if ((dset_ids[i] = H5Dcreate2(file_id, dset_name, H5T_NATIVE_INT, fspace_id, H5P_DEFAULT, dcpl_id,
+                                      H5P_DEFAULT)) < 0) {
+            HDprintf("    couldn't create dataset '%s'\n", dset_name);
+            goto done;
+        }
+    }
+
+    if (H5Sclose(fspace_id) < 0)
+        goto done;
+    fspace_id = H5I_INVALID_HID;
+
+    if (H5Fstart_swmr_write(file_id) < 0) {
+        HDprintf("    couldn't start SWMR writing to file '%s'\n", filename);
+        goto done;
+    }
+
+    /* Let the reader open the file and wait for it to be ready */
+    ack_time = 0.0;
+    if (HDwrite(go_pipe[1], &ack_time, sizeof(ack_time)) != sizeof(ack_time)) {
+        HDprintf("    couldn't signal reader process\n");
+        goto done;
+    }
+    if (HDread(ack_pipe[0], &ack_time, sizeof(ack_time)) != sizeof(ack_time)) {
+        HDprintf("    reader process failed to open file\n");
+        goto done;
+    }
+
+    count[0] = (hsize_t)step_size;
+
+    if ((mspace_id = H5Screate_simple(1, count, NULL)) < 0)
+        goto done;
+
+    for (i = 0; i < DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS; i++) {
+        start[0] = dims[0];
+        dims[0] += (hsize_t)step_size;
+
+        start_time = get_wall_time();
+
+        for (j = 0; j < num_dsets; j++) {
+            size_t k;
+
+            for (k = 0; k < step_size; k++)
+                wbuf[k] = (int)(start[0] + k + j);
+
+            if (H5Dset_extent(dset_ids[j], dims) < 0) {
+                HDprintf("    failed to extend dataset %zu\n", j);
+                goto done;
+            }
+
+            if ((fspace_id = H5Dget_space(dset_ids[j])) < 0) {
+                HDprintf("    failed to retrieve dataspace of dataset %zu\n", j);
+                goto done;
+            }
+
+            if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0) {
+                HDprintf("    couldn't select hyperslab for append\n");
+                goto done;
+            }
+
+            if (H5Dwrite(dset_ids[j], H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT, wbuf) < 0) {
+                HDprintf("    couldn't append to dataset %zu\n", j);
+                goto done;
+            }
+
+            if (H5Sclose(fspace_id) < 0)
+                goto done;
+            fspace_id = H5I_INVALID_HID;
+        }
+
+        flush_timings[i] = get_wall_time();
+        *write_time_out += flush_timings[i] - start_time;
+
+        for (j = 0; j < num_dsets; j++) {
+            if (H5Dflush(dset_ids[j]) < 0) {
+                HDprintf("    couldn't flush dataset %zu\n", j);
+                goto done;
+            }
+        }
+
+        flush_timings[i] = get_wall_time() - flush_timings[i];
+
+        if (HDread(ack_pipe[0], &ack_time, sizeof(ack_time)) != sizeof(ack_time)) {
+            HDprintf("    reader process failed during append %zu\n", i);
+            goto done;
+        }
+
+        latency_timings[i] = ack_time - start_time;
+    }
+
+    ret_value = 0;
+
+done:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Pclose(dcpl_id);
+        H5Pclose(fapl_id);
+        if (dset_ids)
+            for (i = 0; i < num_dsets; i++)
+                H5Dclose(dset_ids[i]);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    /* Closing the pipes makes the reader process exit if it is still waiting */
+    if (go_pipe[0] >= 0)
+        HDclose(go_pipe[0]);
+    if (go_pipe[1] >= 0)
+        HDclose(go_pipe[1]);
+    if (ack_pipe[0] >= 0)
+        HDclose(ack_pipe[0]);
+    if (ack_pipe[1] >= 0)
+        HDclose(ack_pipe[1]);
+
+    if (pid > 0) {
+        if (HDwaitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) {
+            HDprintf("    reader process didn't exit successfully\n");
+            ret_value = -1;
+        }
+    }
+
+    HDfree(wbuf);
+    HDfree(dset_ids);
+
+    return ret_value;
+}
+
+/*
+ * Prints the writer throughput, flush cost and visibility latency
+ * from a single run of the flush and refresh benchmark.
+ */
+static void
+dataset_flush_refresh_bench_report(size_t num_dsets, size_t step_size, double *flush_timings,
+                                   double *latency_timings, double write_time)
+{
+    double mbytes = (double)(num_dsets * step_size * sizeof(int)) * DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS /
+                    (1024.0 * 1024.0);
+    double total_flush_time = 0.0;
+    size_t i;
+
+    for (i = 0; i < DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS; i++)
+        total_flush_time += flush_timings[i];
+
+    sort_timings(flush_timings, DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS);
+    sort_timings(latency_timings, DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS);
+
+    HDprintf("    %d appends, %.2f MiB: H5Dwrite %.6f s, H5Dflush %.6f s (%.2f MiB/s with flushing)\n",
+             DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS, mbytes, write_time, total_flush_time,
+             (write_time + total_flush_time > 0.0) ? mbytes / (write_time + total_flush_time) : 0.0);
+    HDprintf("    H5Dflush of all datasets per append (ms): p50 %.3f, p99 %.3f, max %.3f\n",
+             get_timing_percentile(flush_timings, DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS, 50.0) * 1.0E3,
+             get_timing_percentile(flush_timings, DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS, 99.0) * 1.0E3,
+             flush_timings[DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS - 1] * 1.0E3);
+    HDprintf("    visibility latency from append to read (ms): p50 %.3f, p99 %.3f, max %.3f\n",
+             get_timing_percentile(latency_timings, DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS, 50.0) * 1.0E3,
+             get_timing_percentile(latency_timings, DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS, 99.0) * 1.0E3,
+             latency_timings[DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS - 1] * 1.0E3);
+}
+#endif
+
+/*
+ * A test to create a dataset composed of a single chunk.
+ */
+static int
+test_create_single_chunk_dataset(void)
+{
+    hsize_t dims[DATASET_SINGLE_CHUNK_TEST_SPACE_RANK];
+    hsize_t retrieved_chunk_dims[DATASET_SINGLE_CHUNK_TEST_SPACE_RANK];
+    size_t  i;
+    hid_t   file_id         = H5I_INVALID_HID;
+    hid_t   container_group = H5I_INVALID_HID, group_id = H5I_INVALID_HID;
+    hid_t   dset_id    = H5I_INVALID_HID;
+    hid_t   dset_dtype = H5I_INVALID_HID;
+    hid_t   dcpl_id    = H5I_INVALID_HID;
+    hid_t   fspace_id  = H5I_INVALID_HID;
+
+    TESTING("creation of dataset with single chunk");
 
     /* Make sure the connector supports the API functions being tested */
     if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
-        !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_MORE) ||
-        !(vol_cap_flags_g & H5VL_CAP_FLAG_GET_PLIST)) {
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GET_PLIST)) {
         SKIPPED();
         HDprintf("    API functions for basic file, group, dataset, or get property list aren't supported "
                  "with this connector\n");
@@ -11606,32 +12696,31 @@ test_write_single_chunk_dataset(void)
         goto error;
     }
 
-    if ((group_id = H5Gcreate2(container_group, DATASET_SINGLE_CHUNK_WRITE_TEST_GROUP_NAME, H5P_DEFAULT,
+    if ((group_id = H5Gcreate2(container_group, DATASET_SINGLE_CHUNK_TEST_GROUP_NAME, H5P_DEFAULT,
                                H5P_DEFAULT, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        HDprintf("    couldn't create container sub-group '%s'\n",
-                 DATASET_SINGLE_CHUNK_WRITE_TEST_GROUP_NAME);
+        HDprintf("    couldn't create container sub-group '%s'\n", DATASET_SINGLE_CHUNK_TEST_GROUP_NAME);
         goto error;
     }
 
-    if ((fspace_id = generate_random_dataspace(DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_SPACE_RANK, NULL, dims,
-                                               FALSE)) < 0)
+    if ((fspace_id = generate_random_dataspace(DATASET_SINGLE_CHUNK_TEST_SPACE_RANK, NULL, dims, FALSE)) < 0)
+        TEST_ERROR;
+    if ((dset_dtype = generate_random_datatype(H5T_NO_CLASS, FALSE)) < 0)
         TEST_ERROR;
 
     if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
         TEST_ERROR;
 
-    if (H5Pset_chunk(dcpl_id, DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_SPACE_RANK, dims) < 0) {
+    if (H5Pset_chunk(dcpl_id, DATASET_SINGLE_CHUNK_TEST_SPACE_RANK, dims) < 0) {
         H5_FAILED();
         HDprintf("    failed to set chunking on DCPL\n");
         goto error;
     }
 
-    if ((dset_id = H5Dcreate2(group_id, DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_NAME,
-                              DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_DTYPE, fspace_id, H5P_DEFAULT, dcpl_id,
-                              H5P_DEFAULT)) < 0) {
+    if ((dset_id = H5Dcreate2(group_id, DATASET_SINGLE_CHUNK_TEST_DSET_NAME, dset_dtype, fspace_id,
+                              H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        HDprintf("    couldn't create dataset '%s'\n", DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_NAME);
+        HDprintf("    couldn't create dataset '%s'\n", DATASET_SINGLE_CHUNK_TEST_DSET_NAME);
         goto error;
     }
 
@@ -11651,13 +12740,13 @@ test_write_single_chunk_dataset(void)
     }
 
     memset(retrieved_chunk_dims, 0, sizeof(retrieved_chunk_dims));
-    if (H5Pget_chunk(dcpl_id, DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_SPACE_RANK, retrieved_chunk_dims) < 0) {
+    if (H5Pget_chunk(dcpl_id, DATASET_SINGLE_CHUNK_TEST_SPACE_RANK, retrieved_chunk_dims) < 0) {
         H5_FAILED();
         HDprintf("    failed to retrieve chunking info\n");
         goto error;
     }
 
-    for (i = 0; i < DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_SPACE_RANK; i++) {
+    for (i = 0; i < DATASET_SINGLE_CHUNK_TEST_SPACE_RANK; i++) {
         if (dims[i] != retrieved_chunk_dims[i]) {
             H5_FAILED();
             HDprintf("    chunk dimensionality retrieved from DCPL didn't match originally specified "
@@ -11666,75 +12755,257 @@ test_write_single_chunk_dataset(void)
         }
     }
 
-    for (i = 0, data_size = 1; i < DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_SPACE_RANK; i++)
-        data_size *= dims[i];
-    data_size *= DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_DTYPESIZE;
-
-    if (NULL == (write_buf = HDmalloc(data_size)))
-        TEST_ERROR;
-
-    for (i = 0; i < data_size / DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_DTYPESIZE; i++)
-        ((int *)write_buf)[i] = (int)i;
-
-    if (H5Dwrite(dset_id, DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
-                 write_buf) < 0) {
+    /*
+     * Now close the dataset and retrieve a copy
+     * of the DCPL after re-opening it.
+     */
+    if (H5Pclose(dcpl_id) < 0) {
         H5_FAILED();
-        HDprintf("    couldn't write to dataset '%s'\n", DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_NAME);
+        HDprintf("    failed to close DCPL\n");
         goto error;
     }
 
-    if (write_buf) {
-        HDfree(write_buf);
-        write_buf = NULL;
-    }
-
-    if (fspace_id >= 0) {
-        H5E_BEGIN_TRY
-        {
-            H5Sclose(fspace_id);
-        }
-        H5E_END_TRY;
-        fspace_id = H5I_INVALID_HID;
-    }
-    if (dset_id >= 0) {
-        H5E_BEGIN_TRY
-        {
-            H5Dclose(dset_id);
-        }
-        H5E_END_TRY;
-        dset_id = H5I_INVALID_HID;
-    }
-
-    if ((dset_id = H5Dopen2(group_id, DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
+    if (H5Dclose(dset_id) < 0) {
         H5_FAILED();
-        HDprintf("    couldn't open dataset '%s'\n", DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_NAME);
+        HDprintf("    failed to close dataset\n");
         goto error;
     }
 
-    if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+    if ((dset_id = H5Dopen2(group_id, DATASET_SINGLE_CHUNK_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
         H5_FAILED();
-        HDprintf("    couldn't get dataset dataspace\n");
+        HDprintf("    failed to re-open dataset\n");
         goto error;
     }
 
-    if ((space_npoints = H5Sget_simple_extent_npoints(fspace_id)) < 0) {
+    if ((dcpl_id = H5Dget_create_plist(dset_id)) < 0) {
         H5_FAILED();
-        HDprintf("    couldn't get dataspace num points\n");
+        HDprintf("    failed to retrieve copy of DCPL\n");
         goto error;
     }
 
-    if (NULL ==
-        (read_buf = HDmalloc((hsize_t)space_npoints * DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_DTYPESIZE))) {
+    memset(retrieved_chunk_dims, 0, sizeof(retrieved_chunk_dims));
+    if (H5Pget_chunk(dcpl_id, DATASET_SINGLE_CHUNK_TEST_SPACE_RANK, retrieved_chunk_dims) < 0) {
         H5_FAILED();
-        HDprintf("    couldn't allocate buffer for dataset read\n");
+        HDprintf("    failed to retrieve chunking info\n");
         goto error;
     }
 
-    if (H5Dread(dset_id, DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
-                read_buf) < 0) {
-        H5_FAILED();
-        HDprintf("    couldn't read from dataset '%s'\n", DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_NAME);
-        goto error;
+    for (i = 0; i < DATASET_SINGLE_CHUNK_TEST_SPACE_RANK; i++) {
+        if (dims[i] != retrieved_chunk_dims[i]) {
+            H5_FAILED();
+            HDprintf("    chunk dimensionality retrieved from DCPL didn't match originally specified "
+                     "dimensionality\n");
+            goto error;
+        }
+    }
+
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR;
+    if (H5Tclose(dset_dtype) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dcpl_id);
+        H5Sclose(fspace_id);
+        H5Tclose(dset_dtype);
+        H5Dclose(dset_id);
+        H5Gclose(group_id);
+        H5Gclose(container_group);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+/*
+ * A test to check that a single-chunk dataset can be written
+ * and read correctly.
+ */
+static int
+test_write_single_chunk_dataset(void)
+{
+    hssize_t space_npoints;
+    hsize_t  dims[DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_SPACE_RANK];
+    hsize_t  retrieved_chunk_dims[DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_SPACE_RANK];
+    size_t   i, data_size;
+    hid_t    file_id         = H5I_INVALID_HID;
+    hid_t    container_group = H5I_INVALID_HID, group_id = H5I_INVALID_HID;
+    hid_t    dset_id   = H5I_INVALID_HID;
+    hid_t    dcpl_id   = H5I_INVALID_HID;
+    hid_t    fspace_id = H5I_INVALID_HID;
+    void    *write_buf = NULL;
+    void    *read_buf  = NULL;
+
+    TESTING("write to dataset with single chunk");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_MORE) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_GET_PLIST)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file, group, dataset, or get property list aren't supported "
+                 "with this connector\n");
+        return 0;
+    }
+
+    if ((file_id = H5Fopen(vol_test_filename, H5F_ACC_RDWR, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open file '%s'\n", vol_test_filename);
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open container group '%s'\n", DATASET_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((group_id = H5Gcreate2(container_group, DATASET_SINGLE_CHUNK_WRITE_TEST_GROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create container sub-group '%s'\n",
+                 DATASET_SINGLE_CHUNK_WRITE_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((fspace_id = generate_random_dataspace(DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_SPACE_RANK, NULL, dims,
+                                               FALSE)) < 0)
+        TEST_ERROR;
+
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+
+    if (H5Pset_chunk(dcpl_id, DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_SPACE_RANK, dims) < 0) {
+        H5_FAILED();
+        HDprintf("    failed to set chunking on DCPL\n");
+        goto error;
+    }
+
+    if ((dset_id = H5Dcreate2(group_id, DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_NAME,
+                              DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_DTYPE, fspace_id, H5P_DEFAULT, dcpl_id,
+                              H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create dataset '%s'\n", DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_NAME);
+        goto error;
+    }
+
+    /*
+     * See if a copy of the DCPL reports the correct chunking.
+     */
+    if (H5Pclose(dcpl_id) < 0) {
+        H5_FAILED();
+        HDprintf("    failed to close DCPL\n");
+        goto error;
+    }
+
+    if ((dcpl_id = H5Dget_create_plist(dset_id)) < 0) {
+        H5_FAILED();
+        HDprintf("    failed to retrieve copy of DCPL\n");
+        goto error;
+    }
+
+    memset(retrieved_chunk_dims, 0, sizeof(retrieved_chunk_dims));
+    if (H5Pget_chunk(dcpl_id, DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_SPACE_RANK, retrieved_chunk_dims) < 0) {
+        H5_FAILED();
+        HDprintf("    failed to retrieve chunking info\n");
+        goto error;
+    }
+
+    for (i = 0; i < DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_SPACE_RANK; i++) {
+        if (dims[i] != retrieved_chunk_dims[i]) {
+            H5_FAILED();
+            HDprintf("    chunk dimensionality retrieved from DCPL didn't match originally specified "
+                     "dimensionality\n");
+            goto error;
+        }
+    }
+
+    for (i = 0, data_size = 1; i < DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_SPACE_RANK; i++)
+        data_size *= dims[i];
+    data_size *= DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_DTYPESIZE;
+
+    if (NULL == (write_buf = HDmalloc(data_size)))
+        TEST_ERROR;
+
+    for (i = 0; i < data_size / DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_DTYPESIZE; i++)
+        ((int *)write_buf)[i] = (int)i;
+
+    if (H5Dwrite(dset_id, DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
+                 write_buf) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't write to dataset '%s'\n", DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_NAME);
+        goto error;
+    }
+
+    if (write_buf) {
+        HDfree(write_buf);
+        write_buf = NULL;
+    }
+
+    if (fspace_id >= 0) {
+        H5E_BEGIN_TRY
+        {
+            H5Sclose(fspace_id);
+        }
+        H5E_END_TRY;
+        fspace_id = H5I_INVALID_HID;
+    }
+    if (dset_id >= 0) {
+        H5E_BEGIN_TRY
+        {
+            H5Dclose(dset_id);
+        }
+        H5E_END_TRY;
+        dset_id = H5I_INVALID_HID;
+    }
+
+    if ((dset_id = H5Dopen2(group_id, DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open dataset '%s'\n", DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_NAME);
+        goto error;
+    }
+
+    if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't get dataset dataspace\n");
+        goto error;
+    }
+
+    if ((space_npoints = H5Sget_simple_extent_npoints(fspace_id)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't get dataspace num points\n");
+        goto error;
+    }
+
+    if (NULL ==
+        (read_buf = HDmalloc((hsize_t)space_npoints * DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_DTYPESIZE))) {
+        H5_FAILED();
+        HDprintf("    couldn't allocate buffer for dataset read\n");
+        goto error;
+    }
+
+    if (H5Dread(dset_id, DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
+                read_buf) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't read from dataset '%s'\n", DATASET_SINGLE_CHUNK_WRITE_TEST_DSET_NAME);
+        goto error;
     }
 
     for (i = 0; i < (hsize_t)space_npoints; i++)
@@ -13943,6 +15214,592 @@ error:
     return 1;
 } /* end test_get_vlen_buf_size() */
 
+/*
+ * A benchmark to measure the cost of writing and reading large amounts
+ * of variable-length data. VL strings and VL sequences are written with
+ * fixed, uniformly-distributed and heavy-tailed length distributions and
+ * then read back, timing H5Dwrite, H5Dvlen_get_buf_size, H5Dread and
+ * H5Treclaim. The data is also read back with a custom VL memory manager
+ * to check that all of the memory allocated by the read is reclaimed. A
+ * fixed-length string dataset of the same number of elements is used as
+ * a baseline.
+ */
+static int
+test_dataset_vlen_io_benchmark(void)
+{
+    dataset_vlen_bench_times_t times;
+    hid_t                      file_id         = H5I_INVALID_HID;
+    hid_t                      container_group = H5I_INVALID_HID;
+    hid_t                      group_id        = H5I_INVALID_HID;
+
+    TESTING_MULTIPART("variable-length data I/O benchmark");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_MORE)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file, group, or dataset aren't supported with this "
+                 "connector\n");
+        return 0;
+    }
+
+    TESTING_2("test setup");
+
+    if ((file_id = H5Fopen(vol_test_filename, H5F_ACC_RDWR, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open file '%s'\n", vol_test_filename);
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATASET_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open container group '%s'\n", DATASET_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((group_id = H5Gcreate2(container_group, DATASET_VLEN_IO_BENCH_GROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                               H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create container sub-group '%s'\n", DATASET_VLEN_IO_BENCH_GROUP_NAME);
+        goto error;
+    }
+
+    PASSED();
+
+    BEGIN_MULTIPART
+    {
+        PART_BEGIN(fixed_length_string_baseline)
+        {
+            TESTING_2("fixed-length strings (baseline)");
+
+            if (dataset_vlen_bench_run(group_id, "fixed_length_strings", DATASET_VLEN_BENCH_FIXED_STRING,
+                                       DATASET_VLEN_BENCH_DIST_FIXED, &times) < 0)
+                PART_TEST_ERROR(fixed_length_string_baseline);
+
+            PASSED();
+
+            dataset_vlen_bench_report(DATASET_VLEN_BENCH_FIXED_STRING, &times);
+        }
+        PART_END(fixed_length_string_baseline);
+
+        PART_BEGIN(vlen_string_fixed_dist)
+        {
+            TESTING_2("VL strings with fixed lengths");
+
+            if (dataset_vlen_bench_run(group_id, "vlen_strings_fixed", DATASET_VLEN_BENCH_VLEN_STRING,
+                                       DATASET_VLEN_BENCH_DIST_FIXED, &times) < 0)
+                PART_TEST_ERROR(vlen_string_fixed_dist);
+
+            PASSED();
+
+            dataset_vlen_bench_report(DATASET_VLEN_BENCH_VLEN_STRING, &times);
+        }
+        PART_END(vlen_string_fixed_dist);
+
+        PART_BEGIN(vlen_string_uniform_dist)
+        {
+            TESTING_2("VL strings with uniformly-distributed lengths");
+
+            if (dataset_vlen_bench_run(group_id, "vlen_strings_uniform", DATASET_VLEN_BENCH_VLEN_STRING,
+                                       DATASET_VLEN_BENCH_DIST_UNIFORM, &times) < 0)
+                PART_TEST_ERROR(vlen_string_uniform_dist);
+
+            PASSED();
+
+            dataset_vlen_bench_report(DATASET_VLEN_BENCH_VLEN_STRING, &times);
+        }
+        PART_END(vlen_string_uniform_dist);
+
+        PART_BEGIN(vlen_string_heavy_tailed_dist)
+        {
+            TESTING_2("VL strings with heavy-tailed lengths");
+
+            if (dataset_vlen_bench_run(group_id, "vlen_strings_heavy_tailed", DATASET_VLEN_BENCH_VLEN_STRING,
+                                       DATASET_VLEN_BENCH_DIST_HEAVY_TAILED, &times) < 0)
+                PART_TEST_ERROR(vlen_string_heavy_tailed_dist);
+
+            PASSED();
+
+            dataset_vlen_bench_report(DATASET_VLEN_BENCH_VLEN_STRING, &times);
+        }
+        PART_END(vlen_string_heavy_tailed_dist);
+
+        PART_BEGIN(vlen_sequence_fixed_dist)
+        {
+            TESTING_2("VL sequences with fixed lengths");
+
+            if (dataset_vlen_bench_run(group_id, "vlen_sequences_fixed", DATASET_VLEN_BENCH_VLEN_SEQUENCE,
+                                       DATASET_VLEN_BENCH_DIST_FIXED, &times) < 0)
+                PART_TEST_ERROR(vlen_sequence_fixed_dist);
+
+            PASSED();
+
+            dataset_vlen_bench_report(DATASET_VLEN_BENCH_VLEN_SEQUENCE, &times);
+        }
+        PART_END(vlen_sequence_fixed_dist);
+
+        PART_BEGIN(vlen_sequence_uniform_dist)
+        {
+            TESTING_2("VL sequences with uniformly-distributed lengths");
+
+            if (dataset_vlen_bench_run(group_id, "vlen_sequences_uniform", DATASET_VLEN_BENCH_VLEN_SEQUENCE,
+                                       DATASET_VLEN_BENCH_DIST_UNIFORM, &times) < 0)
+                PART_TEST_ERROR(vlen_sequence_uniform_dist);
+
+            PASSED();
+
+            dataset_vlen_bench_report(DATASET_VLEN_BENCH_VLEN_SEQUENCE, &times);
+        }
+        PART_END(vlen_sequence_uniform_dist);
+
+        PART_BEGIN(vlen_sequence_heavy_tailed_dist)
+        {
+            TESTING_2("VL sequences with heavy-tailed lengths");
+
+            if (dataset_vlen_bench_run(group_id, "vlen_sequences_heavy_tailed",
+                                       DATASET_VLEN_BENCH_VLEN_SEQUENCE, DATASET_VLEN_BENCH_DIST_HEAVY_TAILED,
+                                       &times) < 0)
+                PART_TEST_ERROR(vlen_sequence_heavy_tailed_dist);
+
+            PASSED();
+
+            dataset_vlen_bench_report(DATASET_VLEN_BENCH_VLEN_SEQUENCE, &times);
+        }
+        PART_END(vlen_sequence_heavy_tailed_dist);
+    }
+    END_MULTIPART;
+
+    TESTING_2("test cleanup");
+
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Gclose(group_id);
+        H5Gclose(container_group);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+/*
+ * Returns a length for a single element of the VL I/O benchmark's
+ * data according to the given length distribution. Heavy-tailed
+ * lengths are generated by repeatedly doubling a minimum length with
+ * probability 1/2, giving a power-law-like distribution of lengths.
+ */
+static size_t
+dataset_vlen_bench_gen_length(dataset_vlen_bench_dist_t dist)
+{
+    size_t len = DATASET_VLEN_IO_BENCH_MEAN_LEN;
+
+    switch (dist) {
+        case DATASET_VLEN_BENCH_DIST_FIXED:
+            break;
+
+        case DATASET_VLEN_BENCH_DIST_UNIFORM:
+            len = (size_t)(rand() % (2 * DATASET_VLEN_IO_BENCH_MEAN_LEN - 1)) + 1;
+            break;
+
+        case DATASET_VLEN_BENCH_DIST_HEAVY_TAILED:
+            len = DATASET_VLEN_IO_BENCH_HEAVY_TAIL_MIN_LEN;
+            while ((len < DATASET_VLEN_IO_BENCH_HEAVY_TAIL_MAX_LEN) && (rand() % 2))
+                len *= 2;
+            len = MIN(len + (size_t)rand() % len, DATASET_VLEN_IO_BENCH_HEAVY_TAIL_MAX_LEN);
+            break;
+
+        default:
+            break;
+    }
+
+    return len;
+}
+
+/*
+ * VL memory allocation routines for the VL I/O benchmark which keep
+ * track of the amount of memory currently allocated, in the same
+ * manner as the custom allocation routines of the ported VL datatype
+ * tests.
+ */
+static void *
+dataset_vlen_bench_alloc(size_t size, void *mem_used)
+{
+    const size_t   extra = MAX(sizeof(void *), sizeof(size_t));
+    unsigned char *mem;
+
+    if (NULL == (mem = HDmalloc(extra + size)))
+        return NULL;
+
+    *(size_t *)((void *)mem) = size;
+    *(size_t *)mem_used += size;
+
+    return mem + extra;
+}
+
+static void
+dataset_vlen_bench_free(void *_mem, void *mem_used)
+{
+    if (_mem) {
+        const size_t   extra = MAX(sizeof(void *), sizeof(size_t));
+        unsigned char *mem   = ((unsigned char *)_mem) - extra;
+
+        *(size_t *)mem_used -= *(size_t *)((void *)mem);
+        HDfree(mem);
+    }
+}
+
+/*
+ * Verifies the data read back by the VL I/O benchmark against the
+ * lengths and data pattern used when writing it.
+ */
+static int
+dataset_vlen_bench_verify(dataset_vlen_bench_kind_t kind, const size_t *lengths, const void *rbuf)
+{
+    size_t i, j;
+
+    for (i = 0; i < DATASET_VLEN_IO_BENCH_NUM_ELEMS; i++) {
+        if (DATASET_VLEN_BENCH_VLEN_SEQUENCE == kind) {
+            const hvl_t *seq = &((const hvl_t *)rbuf)[i];
+
+            if (seq->len != lengths[i]) {
+                HDprintf("    length of sequence %zu was %zu instead of %zu\n", i, seq->len, lengths[i]);
+                return -1;
+            }
+
+            for (j = 0; j < lengths[i]; j++)
+                if (((const int *)seq->p)[j] != (int)(i + j)) {
+                    HDprintf("    data verification failed for sequence %zu\n", i);
+                    return -1;
+                }
+        }
+        else {
+            const char *str;
+
+            if (DATASET_VLEN_BENCH_VLEN_STRING == kind)
+                str = ((char *const *)rbuf)[i];
+            else
+                str = (const char *)rbuf + (i * (DATASET_VLEN_IO_BENCH_MEAN_LEN + 1));
+
+            if (!str || HDstrlen(str) != lengths[i]) {
+                HDprintf("    length of string %zu didn't match expected length %zu\n", i, lengths[i]);
+                return -1;
+            }
+
+            for (j = 0; j < lengths[i]; j++)
+                if (str[j] != (char)('a' + ((i + j) % 26))) {
+                    HDprintf("    data verification failed for string %zu\n", i);
+                    return -1;
+                }
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Helper for the VL I/O benchmark which creates a dataset of the given
+ * kind and length distribution, writes and reads it back, and returns
+ * the time taken by each operation.
+ */
+static int
+dataset_vlen_bench_run(hid_t group_id, const char *dset_name, dataset_vlen_bench_kind_t kind,
+                       dataset_vlen_bench_dist_t dist, dataset_vlen_bench_times_t *times)
+{
+    hsize_t dims[1]   = {DATASET_VLEN_IO_BENCH_NUM_ELEMS};
+    hsize_t buf_size  = 0;
+    size_t *lengths   = NULL;
+    size_t  elem_size = 0;
+    size_t  nbytes    = 0;
+    size_t  mem_used  = 0;
+    size_t  i, j;
+    double  start_time;
+    hbool_t rbuf_needs_reclaim = FALSE;
+    hid_t   dset_id            = H5I_INVALID_HID;
+    hid_t   type_id            = H5I_INVALID_HID;
+    hid_t   space_id           = H5I_INVALID_HID;
+    hid_t   dxpl_id            = H5I_INVALID_HID;
+    char   *pool               = NULL;
+    void   *wbuf               = NULL;
+    void   *rbuf               = NULL;
+    int     ret_value          = -1;
+
+    HDmemset(times, 0, sizeof(*times));
+
+    if (NULL == (lengths = HDmalloc(DATASET_VLEN_IO_BENCH_NUM_ELEMS * sizeof(*lengths)))) {
+        HDprintf("    couldn't allocate buffer for element lengths\n");
+        goto done;
+    }
+
+    for (i = 0; i < DATASET_VLEN_IO_BENCH_NUM_ELEMS; i++) {
+        lengths[i] = dataset_vlen_bench_gen_length(dist);
+
+        if (DATASET_VLEN_BENCH_VLEN_SEQUENCE == kind)
+            nbytes += lengths[i] * sizeof(int);
+        else
+            nbytes += lengths[i] + 1;
+    }
+
+    /* Set up the datatype and the buffer of data to write */
+    switch (kind) {
+        case DATASET_VLEN_BENCH_FIXED_STRING:
+            elem_size = DATASET_VLEN_IO_BENCH_MEAN_LEN + 1;
+
+            if ((type_id = H5Tcopy(H5T_C_S1)) < 0 || H5Tset_size(type_id, elem_size) < 0) {
+                HDprintf("    couldn't create fixed-length string datatype\n");
+                goto done;
+            }
+
+            if (NULL == (pool = HDmalloc(nbytes))) {
+                HDprintf("    couldn't allocate write buffer\n");
+                goto done;
+            }
+
+            for (i = 0; i < DATASET_VLEN_IO_BENCH_NUM_ELEMS; i++) {
+                for (j = 0; j < lengths[i]; j++)
+                    pool[(i * elem_size) + j] = (char)('a' + ((i + j) % 26));
+                pool[(i * elem_size) + lengths[i]] = '\0';
+            }
+
+            wbuf = pool;
+            pool = NULL;
+
+            break;
+
+        case DATASET_VLEN_BENCH_VLEN_STRING: {
+            char **wstrs;
+            size_t offset = 0;
+
+            elem_size = sizeof(char *);
+
+            if ((type_id = H5Tcopy(H5T_C_S1)) < 0 || H5Tset_size(type_id, H5T_VARIABLE) < 0) {
+                HDprintf("    couldn't create variable-length string datatype\n");
+                goto done;
+            }
+
+            if (NULL == (pool = HDmalloc(nbytes)) ||
+                NULL == (wbuf = HDmalloc(DATASET_VLEN_IO_BENCH_NUM_ELEMS * elem_size))) {
+                HDprintf("    couldn't allocate write buffer\n");
+                goto done;
+            }
+
+            wstrs = (char **)wbuf;
+            for (i = 0; i < DATASET_VLEN_IO_BENCH_NUM_ELEMS; i++) {
+                wstrs[i] = pool + offset;
+                for (j = 0; j < lengths[i]; j++)
+                    wstrs[i][j] = (char)('a' + ((i + j) % 26));
+                wstrs[i][lengths[i]] = '\0';
+                offset += lengths[i] + 1;
+            }
+
+            break;
+        }
+
+        case DATASET_VLEN_BENCH_VLEN_SEQUENCE: {
+            hvl_t *wseqs;
+            int   *ints;
+
+            elem_size = sizeof(hvl_t);
+
+            if ((type_id = H5Tvlen_create(H5T_NATIVE_INT)) < 0) {
+                HDprintf("    couldn't create variable-length sequence datatype\n");
+                goto done;
+            }
+
+            if (NULL == (pool = HDmalloc(nbytes)) ||
+                NULL == (wbuf = HDmalloc(DATASET_VLEN_IO_BENCH_NUM_ELEMS * elem_size))) {
+                HDprintf("    couldn't allocate write buffer\n");
+                goto done;
+            }
+
+            wseqs = (hvl_t *)wbuf;
+            ints  = (int *)((void *)pool);
+            for (i = 0; i < DATASET_VLEN_IO_BENCH_NUM_ELEMS; i++) {
+                wseqs[i].len = lengths[i];
+                wseqs[i].p   = ints;
+                for (j = 0; j < lengths[i]; j++)
+                    ints[j] = (int)(i + j);
+                ints += lengths[i];
+            }
+
+            break;
+        }
+
+        default:
+            HDprintf("    invalid VL benchmark data kind\n");
+            goto done;
+    }
+
+    if (NULL == (rbuf = HDcalloc(DATASET_VLEN_IO_BENCH_NUM_ELEMS, elem_size))) {
+        HDprintf("    couldn't allocate read buffer\n");
+        goto done;
+    }
+
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0) {
+        HDprintf("    couldn't create dataspace\n");
+        goto done;
+    }
+
+    if ((dset_id = H5Dcreate2(group_id, dset_name, type_id, space_id, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0) {
+        HDprintf("    couldn't create dataset '%s'\n", dset_name);
+        goto done;
+    }
+
+    start_time = get_wall_time();
+
+    if (H5Dwrite(dset_id, type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) {
+        HDprintf("    couldn't write to dataset '%s'\n", dset_name);
+        goto done;
+    }
+
+    times->write = get_wall_time() - start_time;
+
+    if (DATASET_VLEN_BENCH_FIXED_STRING != kind) {
+        start_time = get_wall_time();
+
+        if (H5Dvlen_get_buf_size(dset_id, type_id, space_id, &buf_size) < 0) {
+            HDprintf("    couldn't get VL buffer size for dataset '%s'\n", dset_name);
+            goto done;
+        }
+
+        times->get_buf_size = get_wall_time() - start_time;
+
+        if (buf_size != (hsize_t)nbytes) {
+            HDprintf("    H5Dvlen_get_buf_size returned wrong size (%llu), compared to the correct size (%zu)\n",
+                     (unsigned long long)buf_size, nbytes);
+            goto done;
+        }
+    }
+
+    start_time = get_wall_time();
+
+    if (H5Dread(dset_id, type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) {
+        HDprintf("    couldn't read from dataset '%s'\n", dset_name);
+        goto done;
+    }
+
+    times->read        = get_wall_time() - start_time;
+    rbuf_needs_reclaim = (DATASET_VLEN_BENCH_FIXED_STRING != kind);
+
+    if (dataset_vlen_bench_verify(kind, lengths, rbuf) < 0)
+        goto done;
+
+    if (DATASET_VLEN_BENCH_FIXED_STRING != kind) {
+        start_time = get_wall_time();
+
+        if (H5Treclaim(type_id, space_id, H5P_DEFAULT, rbuf) < 0) {
+            HDprintf("    couldn't reclaim VL data read from dataset '%s'\n", dset_name);
+            goto done;
+        }
+
+        times->reclaim     = get_wall_time() - start_time;
+        rbuf_needs_reclaim = FALSE;
+
+        /* Repeat the read with a custom VL memory manager that tracks allocations */
+        if ((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0) {
+            HDprintf("    couldn't create DXPL\n");
+            goto done;
+        }
+
+        if (H5Pset_vlen_mem_manager(dxpl_id, dataset_vlen_bench_alloc, &mem_used, dataset_vlen_bench_free,
+                                    &mem_used) < 0) {
+            HDprintf("    couldn't set VL memory manager on DXPL\n");
+            goto done;
+        }
+
+        HDmemset(rbuf, 0, DATASET_VLEN_IO_BENCH_NUM_ELEMS * elem_size);
+
+        start_time = get_wall_time();
+
+        if (H5Dread(dset_id, type_id, H5S_ALL, H5S_ALL, dxpl_id, rbuf) < 0) {
+            HDprintf("    couldn't read from dataset '%s' with custom VL memory manager\n", dset_name);
+            goto done;
+        }
+
+        times->read_custom = get_wall_time() - start_time;
+        rbuf_needs_reclaim = TRUE;
+
+        if (mem_used != nbytes) {
+            HDprintf("    read allocated %zu bytes of VL data instead of %zu bytes\n", mem_used, nbytes);
+            goto done;
+        }
+
+        if (dataset_vlen_bench_verify(kind, lengths, rbuf) < 0)
+            goto done;
+
+        start_time = get_wall_time();
+
+        if (H5Treclaim(type_id, space_id, dxpl_id, rbuf) < 0) {
+            HDprintf("    couldn't reclaim VL data with custom VL memory manager\n");
+            goto done;
+        }
+
+        times->reclaim_custom = get_wall_time() - start_time;
+        rbuf_needs_reclaim    = FALSE;
+
+        if (mem_used != 0) {
+            HDprintf("    %zu bytes of VL data were not reclaimed\n", mem_used);
+            goto done;
+        }
+    }
+
+    times->nbytes = nbytes;
+
+    ret_value = 0;
+
+done:
+    H5E_BEGIN_TRY
+    {
+        if (rbuf_needs_reclaim)
+            H5Treclaim(type_id, space_id, (dxpl_id >= 0) ? dxpl_id : H5P_DEFAULT, rbuf);
+        H5Pclose(dxpl_id);
+        H5Dclose(dset_id);
+        H5Sclose(space_id);
+        H5Tclose(type_id);
+    }
+    H5E_END_TRY;
+
+    HDfree(rbuf);
+    HDfree(wbuf);
+    HDfree(pool);
+    HDfree(lengths);
+
+    return ret_value;
+}
+
+/*
+ * Prints the timings from a single run of the VL I/O benchmark.
+ */
+static void
+dataset_vlen_bench_report(dataset_vlen_bench_kind_t kind, const dataset_vlen_bench_times_t *times)
+{
+    double mbytes = (double)times->nbytes / (1024.0 * 1024.0);
+
+    HDprintf("    %d elements, %zu bytes of data\n", DATASET_VLEN_IO_BENCH_NUM_ELEMS, times->nbytes);
+    HDprintf("    H5Dwrite: %.6f s (%.2f MiB/s), H5Dread: %.6f s (%.2f MiB/s)\n", times->write,
+             (times->write > 0.0) ? mbytes / times->write : 0.0, times->read,
+             (times->read > 0.0) ? mbytes / times->read : 0.0);
+
+    if (DATASET_VLEN_BENCH_FIXED_STRING != kind) {
+        HDprintf("    H5Dvlen_get_buf_size: %.6f s, H5Treclaim: %.6f s\n", times->get_buf_size,
+                 times->reclaim);
+        HDprintf("    H5Dread with custom VL allocator: %.6f s, H5Treclaim: %.6f s\n", times->read_custom,
+                 times->reclaim_custom);
+    }
+}
+
 int
 vol_dataset_test(void)
 {
@@ -263,6 +263,19 @@ int vol_dataset_test(void);
 #define DATASET_DATA_COMPOUND_PARTIAL_IO_TEST_GROUP_NAME "dataset_compound_partial_io_test"
 #define DATASET_DATA_COMPOUND_PARTIAL_IO_TEST_DSET_NAME  "dataset_compound_partial_io_test"
 
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define DATASET_COMPOUND_PARTIAL_IO_BENCH_NUM_MEMBERS 200
+#define DATASET_COMPOUND_PARTIAL_IO_BENCH_DSET_DIMS   1024
+#define DATASET_COMPOUND_PARTIAL_IO_BENCH_NUM_ITERS   5
+#else
+#define DATASET_COMPOUND_PARTIAL_IO_BENCH_NUM_MEMBERS 50
+#define DATASET_COMPOUND_PARTIAL_IO_BENCH_DSET_DIMS   8
+#define DATASET_COMPOUND_PARTIAL_IO_BENCH_NUM_ITERS   1
+#endif
+#define DATASET_COMPOUND_PARTIAL_IO_BENCH_MAX_MEMBER_ENC_SIZE 128
+#define DATASET_COMPOUND_PARTIAL_IO_BENCH_GROUP_NAME          "dataset_compound_partial_io_bench"
+#define DATASET_COMPOUND_PARTIAL_IO_BENCH_DSET_NAME           "dataset_compound_partial_io_bench_dset"
+
 #define DATASET_SET_EXTENT_CHUNKED_UNLIMITED_TEST_SPACE_RANK 2
 #define DATASET_SET_EXTENT_CHUNKED_UNLIMITED_TEST_NUM_PASSES 3
 #define DATASET_SET_EXTENT_CHUNKED_UNLIMITED_TEST_GROUP_NAME "set_extent_chunked_unlimited_test"
@@ -291,6 +304,30 @@ int vol_dataset_test(void);
 #define DATASET_SET_EXTENT_INVALID_LAYOUT_TEST_CONTIGUOUS_DSET_NAME                                          \
     "set_extent_invalid_layout_test_contiguous_dset"
 
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define DATASET_APPEND_BENCH_NUM_RECORDS 1000000
+#else
+#define DATASET_APPEND_BENCH_NUM_RECORDS 1024
+#endif
+#define DATASET_APPEND_BENCH_RECORD_LEN  8
+#define DATASET_APPEND_BENCH_CHUNK_SIZES {16, 1024, 16384}
+#define DATASET_APPEND_BENCH_BATCH_SIZES {1, 16, 256}
+#define DATASET_APPEND_BENCH_FILE_NAME   "dataset_append_bench.h5"
+#define DATASET_APPEND_BENCH_DSET_NAME   "append_bench_dset"
+
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS   50
+#define DATASET_FLUSH_REFRESH_BENCH_DSET_COUNTS {1, 8, 64}
+#define DATASET_FLUSH_REFRESH_BENCH_STEP_SIZES  {1024, 65536}
+#else
+#define DATASET_FLUSH_REFRESH_BENCH_NUM_STEPS   5
+#define DATASET_FLUSH_REFRESH_BENCH_DSET_COUNTS {1, 4}
+#define DATASET_FLUSH_REFRESH_BENCH_STEP_SIZES  {256, 4096}
+#endif
+#define DATASET_FLUSH_REFRESH_BENCH_TIMEOUT          30.0
+#define DATASET_FLUSH_REFRESH_BENCH_FILE_NAME        "dataset_flush_refresh_bench.h5"
+#define DATASET_FLUSH_REFRESH_BENCH_DSET_NAME_PREFIX "flush_refresh_bench_dset"
+
 #define DATASET_SINGLE_CHUNK_TEST_SPACE_RANK 2
 #define DATASET_SINGLE_CHUNK_TEST_GROUP_NAME "single_chunk_dataset_test"
 #define DATASET_SINGLE_CHUNK_TEST_DSET_NAME  "single_chunk_dataset"
@@ -353,4 +390,15 @@ int vol_dataset_test(void);
 #define DATASET_GET_VLEN_BUF_SIZE_DSET_SPACE_DIM  4
 #define DATASET_GET_VLEN_BUF_SIZE_GROUP_NAME      "get_vlen_buffer_size_group"
 #define DATASET_GET_VLEN_BUF_SIZE_DSET_NAME       "get_vlen_buffer_size_dset"
+
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define DATASET_VLEN_IO_BENCH_NUM_ELEMS          1000000
+#define DATASET_VLEN_IO_BENCH_HEAVY_TAIL_MAX_LEN 4096
+#else
+#define DATASET_VLEN_IO_BENCH_NUM_ELEMS          1000
+#define DATASET_VLEN_IO_BENCH_HEAVY_TAIL_MAX_LEN 256
+#endif
+#define DATASET_VLEN_IO_BENCH_MEAN_LEN           32
+#define DATASET_VLEN_IO_BENCH_HEAVY_TAIL_MIN_LEN 4
+#define DATASET_VLEN_IO_BENCH_GROUP_NAME         "dataset_vlen_io_bench"
 #endif
@@ -45,36 +45,101 @@ static int test_write_multi_chunk_dataset_diff_shape_read(void);
 static int test_overwrite_multi_chunk_dataset_same_shape_read(void);
 static int test_overwrite_multi_chunk_dataset_diff_shape_read(void);
 
+static int test_dataset_scaling_benchmark(void);
+
 /*
- * The array of parallel dataset tests to be performed.
+ * The different data transfer property lists that the parallel
+ * dataset tests are run with. The whole set of tests is run once
+ * for each variant, using the variant's DXPL for all H5Dwrite and
+ * H5Dread calls that every MPI rank takes part in.
  */
-static int (*par_dataset_tests[])(void) = {
-    test_write_dataset_data_verification,
-    test_write_dataset_independent,
-    test_write_dataset_one_proc_0_selection,
-    test_write_dataset_one_proc_none_selection,
-    test_write_dataset_one_proc_all_selection,
-    test_write_dataset_hyper_file_all_mem,
-    test_write_dataset_all_file_hyper_mem,
-    test_write_dataset_point_file_all_mem,
-    test_write_dataset_all_file_point_mem,
-    test_write_dataset_hyper_file_point_mem,
-    test_write_dataset_point_file_hyper_mem,
-    test_read_dataset_one_proc_0_selection,
-    test_read_dataset_one_proc_none_selection,
-    test_read_dataset_one_proc_all_selection,
-    test_read_dataset_hyper_file_all_mem,
-    test_read_dataset_all_file_hyper_mem,
-    test_read_dataset_point_file_all_mem,
-    test_read_dataset_all_file_point_mem,
-    test_read_dataset_hyper_file_point_mem,
-    test_read_dataset_point_file_hyper_mem,
-    test_write_multi_chunk_dataset_same_shape_read,
-    test_write_multi_chunk_dataset_diff_shape_read,
-    test_overwrite_multi_chunk_dataset_same_shape_read,
-    test_overwrite_multi_chunk_dataset_diff_shape_read,
+typedef enum par_dataset_dxpl_variant_t {
+    PAR_DATASET_DXPL_INDEPENDENT,
+    PAR_DATASET_DXPL_COLLECTIVE,
+    PAR_DATASET_DXPL_COLLECTIVE_LINK_CHUNK,
+    PAR_DATASET_DXPL_COLLECTIVE_MULTI_CHUNK,
+    PAR_DATASET_DXPL_NUM_VARIANTS
+} par_dataset_dxpl_variant_t;
+
+static const char *par_dataset_dxpl_variant_names[PAR_DATASET_DXPL_NUM_VARIANTS] = {
+    "independent I/O",
+    "collective I/O",
+    "collective I/O with link-chunk optimization",
+    "collective I/O with multi-chunk optimization",
 };
 
+/*
+ * Since the tests create objects with fixed names, each DXPL variant
+ * after the first is run against a newly-created container file, as
+ * is every variant when the tests are re-run under a set of MPI-IO
+ * hints.
+ */
+#define PAR_DATASET_DXPL_VARIANT_FILE_NAME "vol_test_parallel_dxpl_variant.h5"
+
+static hid_t create_par_dataset_dxpl(par_dataset_dxpl_variant_t variant);
+
+static int report_par_dataset_hint_sweep(double *test_times, char **hint_set_descs, size_t num_hint_sets);
+
+static hid_t par_dataset_dxpl_id_g = H5P_DEFAULT;
+
+/*
+ * By default, every MPI rank reads back and verifies the whole
+ * dataset in the data verification tests, which doesn't scale
+ * well with the number of ranks. If this environment variable
+ * is set, each rank instead only reads and verifies its own
+ * portion of the dataset and the results from all the ranks
+ * are combined with a checksum reduction.
+ */
+#define HDF5_API_TEST_DISTRIBUTED_VERIFY "HDF5_API_TEST_DISTRIBUTED_VERIFY"
+
+typedef int (*par_dataset_expected_value_func_t)(size_t row, size_t row_elem, size_t row_nelems);
+
+static int verify_par_dataset_data_distributed(hid_t dset_id, hid_t mem_type_id, int space_rank,
+                                               const hsize_t *dims,
+                                               par_dataset_expected_value_func_t expected_value);
+
+static hbool_t par_dataset_distributed_verify_g = FALSE;
+
+/*
+ * X-macro listing the parallel dataset tests to be performed. Both the
+ * array of test functions and the array of test names, used when
+ * reporting per-test results, are built from it so that they always
+ * stay in step.
+ */
+#define PAR_DATASET_TESTS                                                                                    \
+    X(write_dataset_data_verification)                                                                       \
+    X(write_dataset_independent)                                                                             \
+    X(write_dataset_one_proc_0_selection)                                                                    \
+    X(write_dataset_one_proc_none_selection)                                                                 \
+    X(write_dataset_one_proc_all_selection)                                                                  \
+    X(write_dataset_hyper_file_all_mem)                                                                      \
+    X(write_dataset_all_file_hyper_mem)                                                                      \
+    X(write_dataset_point_file_all_mem)                                                                      \
+    X(write_dataset_all_file_point_mem)                                                                      \
+    X(write_dataset_hyper_file_point_mem)                                                                    \
+    X(write_dataset_point_file_hyper_mem)                                                                    \
+    X(read_dataset_one_proc_0_selection)                                                                     \
+    X(read_dataset_one_proc_none_selection)                                                                  \
+    X(read_dataset_one_proc_all_selection)                                                                   \
+    X(read_dataset_hyper_file_all_mem)                                                                       \
+    X(read_dataset_all_file_hyper_mem)                                                                       \
+    X(read_dataset_point_file_all_mem)                                                                       \
+    X(read_dataset_all_file_point_mem)                                                                       \
+    X(read_dataset_hyper_file_point_mem)                                                                     \
+    X(read_dataset_point_file_hyper_mem)                                                                     \
+    X(write_multi_chunk_dataset_same_shape_read)                                                             \
+    X(write_multi_chunk_dataset_diff_shape_read)                                                             \
+    X(overwrite_multi_chunk_dataset_same_shape_read)                                                         \
+    X(overwrite_multi_chunk_dataset_diff_shape_read)                                                         \
+    X(dataset_scaling_benchmark)
+
+#define X(name) test_##name,
+static int (*par_dataset_tests[])(void) = {PAR_DATASET_TESTS};
+#undef X
+#define X(name) #name,
+static const char *par_dataset_test_names[] = {PAR_DATASET_TESTS};
+#undef X
+
 /*
  * A test to ensure that data is read back correctly from
  * a dataset after it has been written in parallel. The test
@@ -89,6 +154,35 @@ static int (*par_dataset_tests[])(void) = {
 #define DATASET_WRITE_DATA_VERIFY_TEST_DSET_NAME1 "dataset_write_data_verification_all"
 #define DATASET_WRITE_DATA_VERIFY_TEST_DSET_NAME2 "dataset_write_data_verification_hyperslab"
 #define DATASET_WRITE_DATA_VERIFY_TEST_DSET_NAME3 "dataset_write_data_verification_points"
+
+/*
+ * The values expected in each of the test's datasets, used
+ * when the data is verified in a distributed manner.
+ */
+static int
+dataset_write_data_verify_all_expected(size_t row, size_t row_elem, size_t row_nelems)
+{
+    return (int)((row * row_nelems) + row_elem);
+}
+
+static int
+dataset_write_data_verify_hyperslab_expected(size_t row, size_t row_elem, size_t row_nelems)
+{
+    UNUSED(row_elem);
+    UNUSED(row_nelems);
+
+    return (int)row;
+}
+
+static int
+dataset_write_data_verify_points_expected(size_t row, size_t row_elem, size_t row_nelems)
+{
+    UNUSED(row_elem);
+    UNUSED(row_nelems);
+
+    return mpi_size - (int)row;
+}
+
 static int
 test_write_dataset_data_verification(void)
 {
@@ -122,7 +216,7 @@ test_write_dataset_data_verification(void)
 
     TESTING_2("test setup");
 
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
 
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
@@ -305,6 +399,19 @@ test_write_dataset_data_verification(void)
                 PART_ERROR(H5Dwrite_all_read);
             }
 
+            if (par_dataset_distributed_verify_g) {
+                if (verify_par_dataset_data_distributed(dset_id, DATASET_WRITE_DATA_VERIFY_TEST_DSET_DTYPE,
+                                                        DATASET_WRITE_DATA_VERIFY_TEST_SPACE_RANK, dims,
+                                                        dataset_write_data_verify_all_expected) < 0) {
+                    H5_FAILED();
+                    HDprintf("    H5S_ALL selection data verification failed\n");
+                    PART_ERROR(H5Dwrite_all_read);
+                }
+
+                PASSED();
+                PART_EMPTY(H5Dwrite_all_read);
+            }
+
             if ((fspace_id = H5Dget_space(dset_id)) < 0) {
                 H5_FAILED();
                 HDprintf("    couldn't get dataset dataspace\n");
@@ -324,8 +431,8 @@ test_write_dataset_data_verification(void)
                 PART_ERROR(H5Dwrite_all_read);
             }
 
-            if (H5Dread(dset_id, DATASET_WRITE_DATA_VERIFY_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
-                        read_buf) < 0) {
+            if (H5Dread(dset_id, DATASET_WRITE_DATA_VERIFY_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL,
+                        par_dataset_dxpl_id_g, read_buf) < 0) {
                 H5_FAILED();
                 HDprintf("    couldn't read from dataset '%s'\n", DATASET_WRITE_DATA_VERIFY_TEST_DSET_NAME1);
                 PART_ERROR(H5Dwrite_all_read);
@@ -436,7 +543,7 @@ test_write_dataset_data_verification(void)
             }
 
             if (H5Dwrite(dset_id, DATASET_WRITE_DATA_VERIFY_TEST_DSET_DTYPE, mspace_id, fspace_id,
-                         H5P_DEFAULT, write_buf) < 0) {
+                         par_dataset_dxpl_id_g, write_buf) < 0) {
                 H5_FAILED();
                 HDprintf("    couldn't write to dataset '%s'\n", DATASET_WRITE_DATA_VERIFY_TEST_DSET_NAME2);
                 PART_ERROR(H5Dwrite_hyperslab_read);
@@ -513,6 +620,19 @@ test_write_dataset_data_verification(void)
                 PART_ERROR(H5Dwrite_hyperslab_read);
             }
 
+            if (par_dataset_distributed_verify_g) {
+                if (verify_par_dataset_data_distributed(dset_id, DATASET_WRITE_DATA_VERIFY_TEST_DSET_DTYPE,
+                                                        DATASET_WRITE_DATA_VERIFY_TEST_SPACE_RANK, dims,
+                                                        dataset_write_data_verify_hyperslab_expected) < 0) {
+                    H5_FAILED();
+                    HDprintf("    hyperslab selection data verification failed\n");
+                    PART_ERROR(H5Dwrite_hyperslab_read);
+                }
+
+                PASSED();
+                PART_EMPTY(H5Dwrite_hyperslab_read);
+            }
+
             if ((fspace_id = H5Dget_space(dset_id)) < 0) {
                 H5_FAILED();
                 HDprintf("    couldn't get dataset dataspace\n");
@@ -532,8 +652,8 @@ test_write_dataset_data_verification(void)
                 PART_ERROR(H5Dwrite_hyperslab_read);
             }
 
-            if (H5Dread(dset_id, DATASET_WRITE_DATA_VERIFY_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
-                        read_buf) < 0) {
+            if (H5Dread(dset_id, DATASET_WRITE_DATA_VERIFY_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL,
+                        par_dataset_dxpl_id_g, read_buf) < 0) {
                 H5_FAILED();
                 HDprintf("    couldn't read from dataset '%s'\n", DATASET_WRITE_DATA_VERIFY_TEST_DSET_NAME2);
                 PART_ERROR(H5Dwrite_hyperslab_read);
@@ -670,7 +790,7 @@ test_write_dataset_data_verification(void)
             }
 
             if (H5Dwrite(dset_id, DATASET_WRITE_DATA_VERIFY_TEST_DSET_DTYPE, mspace_id, fspace_id,
-                         H5P_DEFAULT, write_buf) < 0) {
+                         par_dataset_dxpl_id_g, write_buf) < 0) {
                 H5_FAILED();
                 HDprintf("    couldn't write to dataset '%s'\n", DATASET_WRITE_DATA_VERIFY_TEST_DSET_NAME3);
                 PART_ERROR(H5Dwrite_point_sel_read);
@@ -747,6 +867,19 @@ test_write_dataset_data_verification(void)
                 PART_ERROR(H5Dwrite_point_sel_read);
             }
 
+            if (par_dataset_distributed_verify_g) {
+                if (verify_par_dataset_data_distributed(dset_id, DATASET_WRITE_DATA_VERIFY_TEST_DSET_DTYPE,
+                                                        DATASET_WRITE_DATA_VERIFY_TEST_SPACE_RANK, dims,
+                                                        dataset_write_data_verify_points_expected) < 0) {
+                    H5_FAILED();
+                    HDprintf("    point selection data verification failed\n");
+                    PART_ERROR(H5Dwrite_point_sel_read);
+                }
+
+                PASSED();
+                PART_EMPTY(H5Dwrite_point_sel_read);
+            }
+
             if ((fspace_id = H5Dget_space(dset_id)) < 0) {
                 H5_FAILED();
                 HDprintf("    couldn't get dataset dataspace\n");
@@ -766,8 +899,8 @@ test_write_dataset_data_verification(void)
                 PART_ERROR(H5Dwrite_point_sel_read);
             }
 
-            if (H5Dread(dset_id, DATASET_WRITE_DATA_VERIFY_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
-                        read_buf) < 0) {
+            if (H5Dread(dset_id, DATASET_WRITE_DATA_VERIFY_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL,
+                        par_dataset_dxpl_id_g, read_buf) < 0) {
                 H5_FAILED();
                 HDprintf("    couldn't read from dataset '%s'\n", DATASET_WRITE_DATA_VERIFY_TEST_DSET_NAME3);
                 PART_ERROR(H5Dwrite_point_sel_read);
@@ -938,7 +1071,7 @@ test_write_dataset_independent(void)
         return 0;
     }
 
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
 
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
@@ -1278,7 +1411,7 @@ test_write_dataset_one_proc_0_selection(void)
         return 0;
     }
 
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
 
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
@@ -1369,8 +1502,8 @@ test_write_dataset_one_proc_0_selection(void)
 
     BEGIN_INDEPENDENT_OP(dset_write)
     {
-        if (H5Dwrite(dset_id, DATASET_WRITE_ONE_PROC_0_SEL_TEST_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
-                     write_buf) < 0) {
+        if (H5Dwrite(dset_id, DATASET_WRITE_ONE_PROC_0_SEL_TEST_DSET_DTYPE, mspace_id, fspace_id,
+                     par_dataset_dxpl_id_g, write_buf) < 0) {
             H5_FAILED();
             HDprintf("    couldn't write to dataset '%s'\n", DATASET_WRITE_ONE_PROC_0_SEL_TEST_DSET_NAME);
             INDEPENDENT_OP_ERROR(dset_write);
@@ -1468,8 +1601,8 @@ test_write_dataset_one_proc_0_selection(void)
         goto error;
     }
 
-    if (H5Dread(dset_id, DATASET_WRITE_ONE_PROC_0_SEL_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
-                read_buf) < 0) {
+    if (H5Dread(dset_id, DATASET_WRITE_ONE_PROC_0_SEL_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL,
+                par_dataset_dxpl_id_g, read_buf) < 0) {
         H5_FAILED();
         HDprintf("    couldn't read from dataset '%s'\n", DATASET_WRITE_ONE_PROC_0_SEL_TEST_DSET_NAME);
         goto error;
@@ -1578,7 +1711,7 @@ test_write_dataset_one_proc_none_selection(void)
         return 0;
     }
 
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
 
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
@@ -1683,7 +1816,7 @@ test_write_dataset_one_proc_none_selection(void)
     BEGIN_INDEPENDENT_OP(dset_write)
     {
         if (H5Dwrite(dset_id, DATASET_WRITE_ONE_PROC_NONE_SEL_TEST_DSET_DTYPE, mspace_id, fspace_id,
-                     H5P_DEFAULT, write_buf) < 0) {
+                     par_dataset_dxpl_id_g, write_buf) < 0) {
             H5_FAILED();
             HDprintf("    couldn't write to dataset '%s'\n", DATASET_WRITE_ONE_PROC_NONE_SEL_TEST_DSET_NAME);
             INDEPENDENT_OP_ERROR(dset_write);
@@ -1781,8 +1914,8 @@ test_write_dataset_one_proc_none_selection(void)
         goto error;
     }
 
-    if (H5Dread(dset_id, DATASET_WRITE_ONE_PROC_NONE_SEL_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
-                read_buf) < 0) {
+    if (H5Dread(dset_id, DATASET_WRITE_ONE_PROC_NONE_SEL_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL,
+                par_dataset_dxpl_id_g, read_buf) < 0) {
         H5_FAILED();
         HDprintf("    couldn't read from dataset '%s'\n", DATASET_WRITE_ONE_PROC_NONE_SEL_TEST_DSET_NAME);
         goto error;
@@ -1889,7 +2022,7 @@ test_write_dataset_one_proc_all_selection(void)
         return 0;
     }
 
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
 
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
@@ -1980,7 +2113,7 @@ test_write_dataset_one_proc_all_selection(void)
     BEGIN_INDEPENDENT_OP(dset_write)
     {
         if (H5Dwrite(dset_id, DATASET_WRITE_ONE_PROC_ALL_SEL_TEST_DSET_DTYPE, mspace_id, fspace_id,
-                     H5P_DEFAULT, write_buf) < 0) {
+                     par_dataset_dxpl_id_g, write_buf) < 0) {
             H5_FAILED();
             HDprintf("    couldn't write to dataset '%s'\n", DATASET_WRITE_ONE_PROC_ALL_SEL_TEST_DSET_NAME);
             INDEPENDENT_OP_ERROR(dset_write);
@@ -2078,8 +2211,8 @@ test_write_dataset_one_proc_all_selection(void)
         goto error;
     }
 
-    if (H5Dread(dset_id, DATASET_WRITE_ONE_PROC_ALL_SEL_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
-                read_buf) < 0) {
+    if (H5Dread(dset_id, DATASET_WRITE_ONE_PROC_ALL_SEL_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL,
+                par_dataset_dxpl_id_g, read_buf) < 0) {
         H5_FAILED();
         HDprintf("    couldn't read from dataset '%s'\n", DATASET_WRITE_ONE_PROC_ALL_SEL_TEST_DSET_NAME);
         goto error;
@@ -2187,7 +2320,7 @@ test_write_dataset_hyper_file_all_mem(void)
         return 0;
     }
 
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
 
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
@@ -2257,8 +2390,8 @@ test_write_dataset_hyper_file_all_mem(void)
         goto error;
     }
 
-    if (H5Dwrite(dset_id, DATASET_WRITE_HYPER_FILE_ALL_MEM_TEST_DSET_DTYPE, H5S_ALL, fspace_id, H5P_DEFAULT,
-                 write_buf) < 0) {
+    if (H5Dwrite(dset_id, DATASET_WRITE_HYPER_FILE_ALL_MEM_TEST_DSET_DTYPE, H5S_ALL, fspace_id,
+                 par_dataset_dxpl_id_g, write_buf) < 0) {
         H5_FAILED();
         HDprintf("    couldn't write to dataset '%s'\n", DATASET_WRITE_HYPER_FILE_ALL_MEM_TEST_DSET_NAME);
         goto error;
@@ -2346,8 +2479,8 @@ test_write_dataset_hyper_file_all_mem(void)
         goto error;
     }
 
-    if (H5Dread(dset_id, DATASET_WRITE_HYPER_FILE_ALL_MEM_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
-                read_buf) < 0) {
+    if (H5Dread(dset_id, DATASET_WRITE_HYPER_FILE_ALL_MEM_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL,
+                par_dataset_dxpl_id_g, read_buf) < 0) {
         H5_FAILED();
         HDprintf("    couldn't read from dataset '%s'\n", DATASET_WRITE_HYPER_FILE_ALL_MEM_TEST_DSET_NAME);
         goto error;
@@ -2456,7 +2589,7 @@ test_write_dataset_all_file_hyper_mem(void)
         return 0;
     }
 
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
 
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
@@ -2649,8 +2782,8 @@ test_write_dataset_all_file_hyper_mem(void)
         goto error;
     }
 
-    if (H5Dread(dset_id, DATASET_WRITE_ALL_FILE_HYPER_MEM_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
-                read_buf) < 0) {
+    if (H5Dread(dset_id, DATASET_WRITE_ALL_FILE_HYPER_MEM_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL,
+                par_dataset_dxpl_id_g, read_buf) < 0) {
         H5_FAILED();
         HDprintf("    couldn't read from dataset '%s'\n", DATASET_WRITE_ALL_FILE_HYPER_MEM_TEST_DSET_NAME);
         goto error;
@@ -2765,7 +2898,7 @@ test_write_dataset_all_file_point_mem(void)
         return 0;
     }
 
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
 
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
@@ -2974,8 +3107,8 @@ test_write_dataset_all_file_point_mem(void)
         goto error;
     }
 
-    if (H5Dread(dset_id, DATASET_WRITE_ALL_FILE_POINT_MEM_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
-                read_buf) < 0) {
+    if (H5Dread(dset_id, DATASET_WRITE_ALL_FILE_POINT_MEM_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL,
+                par_dataset_dxpl_id_g, read_buf) < 0) {
         H5_FAILED();
         HDprintf("    couldn't read from dataset '%s'\n", DATASET_WRITE_ALL_FILE_POINT_MEM_TEST_DSET_NAME);
         goto error;
@@ -3081,7 +3214,7 @@ test_write_dataset_hyper_file_point_mem(void)
         return 0;
     }
 
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
 
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
@@ -3193,7 +3326,7 @@ test_write_dataset_hyper_file_point_mem(void)
     }
 
     if (H5Dwrite(dset_id, DATASET_WRITE_HYPER_FILE_POINT_MEM_TEST_DSET_DTYPE, mspace_id, fspace_id,
-                 H5P_DEFAULT, write_buf) < 0) {
+                 par_dataset_dxpl_id_g, write_buf) < 0) {
         H5_FAILED();
         HDprintf("    couldn't write to dataset '%s'\n", DATASET_WRITE_HYPER_FILE_POINT_MEM_TEST_DSET_NAME);
         goto error;
@@ -3293,8 +3426,8 @@ test_write_dataset_hyper_file_point_mem(void)
         goto error;
     }
 
-    if (H5Dread(dset_id, DATASET_WRITE_HYPER_FILE_POINT_MEM_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
-                read_buf) < 0) {
+    if (H5Dread(dset_id, DATASET_WRITE_HYPER_FILE_POINT_MEM_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL,
+                par_dataset_dxpl_id_g, read_buf) < 0) {
         H5_FAILED();
         HDprintf("    couldn't read from dataset '%s'\n", DATASET_WRITE_HYPER_FILE_POINT_MEM_TEST_DSET_NAME);
         goto error;
@@ -3402,7 +3535,7 @@ test_write_dataset_point_file_hyper_mem(void)
         return 0;
     }
 
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
 
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
@@ -3512,7 +3645,7 @@ test_write_dataset_point_file_hyper_mem(void)
     }
 
     if (H5Dwrite(dset_id, DATASET_WRITE_POINT_FILE_HYPER_MEM_TEST_DSET_DTYPE, mspace_id, fspace_id,
-                 H5P_DEFAULT, write_buf) < 0) {
+                 par_dataset_dxpl_id_g, write_buf) < 0) {
         H5_FAILED();
         HDprintf("    couldn't write to dataset '%s'\n", DATASET_WRITE_POINT_FILE_HYPER_MEM_TEST_DSET_NAME);
         goto error;
@@ -3612,8 +3745,8 @@ test_write_dataset_point_file_hyper_mem(void)
         goto error;
     }
 
-    if (H5Dread(dset_id, DATASET_WRITE_POINT_FILE_HYPER_MEM_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
-                read_buf) < 0) {
+    if (H5Dread(dset_id, DATASET_WRITE_POINT_FILE_HYPER_MEM_TEST_DSET_DTYPE, H5S_ALL, H5S_ALL,
+                par_dataset_dxpl_id_g, read_buf) < 0) {
         H5_FAILED();
         HDprintf("    couldn't read from dataset '%s'\n", DATASET_WRITE_POINT_FILE_HYPER_MEM_TEST_DSET_NAME);
         goto error;
@@ -3858,7 +3991,7 @@ test_read_dataset_one_proc_0_selection(void)
     /*
      * Re-open file on all ranks.
      */
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
@@ -3945,8 +4078,8 @@ test_read_dataset_one_proc_0_selection(void)
 
     BEGIN_INDEPENDENT_OP(dset_read)
     {
-        if (H5Dread(dset_id, DATASET_READ_ONE_PROC_0_SEL_TEST_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
-                    read_buf) < 0) {
+        if (H5Dread(dset_id, DATASET_READ_ONE_PROC_0_SEL_TEST_DSET_DTYPE, mspace_id, fspace_id,
+                    par_dataset_dxpl_id_g, read_buf) < 0) {
             H5_FAILED();
             HDprintf("    couldn't read from dataset '%s'\n", DATASET_READ_ONE_PROC_0_SEL_TEST_DSET_NAME);
             INDEPENDENT_OP_ERROR(dset_read);
@@ -4195,7 +4328,7 @@ test_read_dataset_one_proc_none_selection(void)
     /*
      * Re-open file on all ranks.
      */
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
@@ -4297,7 +4430,7 @@ test_read_dataset_one_proc_none_selection(void)
     BEGIN_INDEPENDENT_OP(dset_read)
     {
         if (H5Dread(dset_id, DATASET_READ_ONE_PROC_NONE_SEL_TEST_DSET_DTYPE, mspace_id, fspace_id,
-                    H5P_DEFAULT, read_buf) < 0) {
+                    par_dataset_dxpl_id_g, read_buf) < 0) {
             H5_FAILED();
             HDprintf("    couldn't read from dataset '%s'\n", DATASET_READ_ONE_PROC_NONE_SEL_TEST_DSET_NAME);
             INDEPENDENT_OP_ERROR(dset_read);
@@ -4543,7 +4676,7 @@ test_read_dataset_one_proc_all_selection(void)
     /*
      * Re-open file on all ranks.
      */
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
@@ -4629,8 +4762,8 @@ test_read_dataset_one_proc_all_selection(void)
 
     BEGIN_INDEPENDENT_OP(dset_read)
     {
-        if (H5Dread(dset_id, DATASET_READ_ONE_PROC_ALL_SEL_TEST_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
-                    read_buf) < 0) {
+        if (H5Dread(dset_id, DATASET_READ_ONE_PROC_ALL_SEL_TEST_DSET_DTYPE, mspace_id, fspace_id,
+                    par_dataset_dxpl_id_g, read_buf) < 0) {
             H5_FAILED();
             HDprintf("    couldn't read from dataset '%s'\n", DATASET_READ_ONE_PROC_ALL_SEL_TEST_DSET_NAME);
             INDEPENDENT_OP_ERROR(dset_read);
@@ -4900,7 +5033,7 @@ test_read_dataset_all_file_hyper_mem(void)
     /*
      * Re-open file on all ranks.
      */
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
@@ -5250,7 +5383,7 @@ test_read_dataset_all_file_point_mem(void)
     /*
      * Re-open file on all ranks.
      */
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
@@ -5604,7 +5737,7 @@ test_read_dataset_hyper_file_point_mem(void)
     /*
      * Re-open file on all ranks.
      */
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
@@ -5703,8 +5836,8 @@ test_read_dataset_hyper_file_point_mem(void)
         }
     }
 
-    if (H5Dread(dset_id, DATASET_READ_HYPER_FILE_POINT_MEM_TEST_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
-                read_buf) < 0) {
+    if (H5Dread(dset_id, DATASET_READ_HYPER_FILE_POINT_MEM_TEST_DSET_DTYPE, mspace_id, fspace_id,
+                par_dataset_dxpl_id_g, read_buf) < 0) {
         H5_FAILED();
         HDprintf("    couldn't read from dataset '%s'\n", DATASET_READ_HYPER_FILE_POINT_MEM_TEST_DSET_NAME);
         goto error;
@@ -5959,7 +6092,7 @@ test_read_dataset_point_file_hyper_mem(void)
     /*
      * Re-open file on all ranks.
      */
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
@@ -6059,8 +6192,8 @@ test_read_dataset_point_file_hyper_mem(void)
         }
     }
 
-    if (H5Dread(dset_id, DATASET_READ_POINT_FILE_HYPER_MEM_TEST_DSET_DTYPE, mspace_id, fspace_id, H5P_DEFAULT,
-                read_buf) < 0) {
+    if (H5Dread(dset_id, DATASET_READ_POINT_FILE_HYPER_MEM_TEST_DSET_DTYPE, mspace_id, fspace_id,
+                par_dataset_dxpl_id_g, read_buf) < 0) {
         H5_FAILED();
         HDprintf("    couldn't read from dataset '%s'\n", DATASET_READ_POINT_FILE_HYPER_MEM_TEST_DSET_NAME);
         goto error;
@@ -6437,7 +6570,7 @@ test_write_multi_chunk_dataset_same_shape_read(void)
     /*
      * Re-open file on all ranks.
      */
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
@@ -6529,7 +6662,7 @@ test_write_multi_chunk_dataset_same_shape_read(void)
                 read_buf[j][k] = 0;
 
         if (H5Dread(dset_id, DATASET_MULTI_CHUNK_WRITE_SAME_SPACE_READ_TEST_DSET_DTYPE, mspace_id, fspace_id,
-                    H5P_DEFAULT, read_buf) < 0) {
+                    par_dataset_dxpl_id_g, read_buf) < 0) {
             H5_FAILED();
             HDprintf("    couldn't read from dataset '%s'\n",
                      DATASET_MULTI_CHUNK_WRITE_SAME_SPACE_READ_TEST_DSET_NAME);
@@ -6901,7 +7034,7 @@ test_write_multi_chunk_dataset_diff_shape_read(void)
     /*
      * Re-open file on all ranks.
      */
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
@@ -6995,7 +7128,7 @@ test_write_multi_chunk_dataset_diff_shape_read(void)
                 read_buf[j][k] = 0;
 
         if (H5Dread(dset_id, DATASET_MULTI_CHUNK_WRITE_DIFF_SPACE_READ_TEST_DSET_DTYPE, mspace_id, fspace_id,
-                    H5P_DEFAULT, read_buf) < 0) {
+                    par_dataset_dxpl_id_g, read_buf) < 0) {
             H5_FAILED();
             HDprintf("    couldn't read from dataset '%s'\n",
                      DATASET_MULTI_CHUNK_WRITE_DIFF_SPACE_READ_TEST_DSET_NAME);
@@ -7303,7 +7436,7 @@ test_overwrite_multi_chunk_dataset_same_shape_read(void)
     /*
      * Re-open file on all ranks.
      */
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
@@ -7492,7 +7625,7 @@ test_overwrite_multi_chunk_dataset_same_shape_read(void)
                     read_buf[j][k] = 0;
 
             if (H5Dread(dset_id, DATASET_MULTI_CHUNK_OVERWRITE_SAME_SPACE_READ_TEST_DSET_DTYPE, mspace_id,
-                        fspace_id, H5P_DEFAULT, read_buf) < 0) {
+                        fspace_id, par_dataset_dxpl_id_g, read_buf) < 0) {
                 H5_FAILED();
                 HDprintf("    couldn't read from dataset '%s'\n",
                          DATASET_MULTI_CHUNK_OVERWRITE_SAME_SPACE_READ_TEST_DSET_NAME);
@@ -7829,7 +7962,7 @@ test_overwrite_multi_chunk_dataset_diff_shape_read(void)
     /*
      * Re-open file on all ranks.
      */
-    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
         TEST_ERROR;
     if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
         H5_FAILED();
@@ -8020,7 +8153,7 @@ test_overwrite_multi_chunk_dataset_diff_shape_read(void)
                     read_buf[j][k] = 0;
 
             if (H5Dread(dset_id, DATASET_MULTI_CHUNK_OVERWRITE_DIFF_SPACE_READ_TEST_DSET_DTYPE, mspace_id,
-                        fspace_id, H5P_DEFAULT, read_buf) < 0) {
+                        fspace_id, par_dataset_dxpl_id_g, read_buf) < 0) {
                 H5_FAILED();
                 HDprintf("    couldn't read from dataset '%s'\n",
                          DATASET_MULTI_CHUNK_OVERWRITE_DIFF_SPACE_READ_TEST_DSET_NAME);
@@ -8119,11 +8252,467 @@ error:
     return 1;
 }
 
+/*
+ * A benchmark to measure how parallel dataset I/O scales with the
+ * number of MPI ranks. Each rank writes and then reads back its own
+ * contiguous portion of a 1-D dataset, where the size of each rank's
+ * portion depends on the scaling mode that the tests are run with.
+ */
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define DATASET_SCALING_BENCH_BASE_NUM_ELEMS 16777216
+#else
+#define DATASET_SCALING_BENCH_BASE_NUM_ELEMS 65536
+#endif
+#define DATASET_SCALING_BENCH_DSET_DTYPE H5T_NATIVE_INT
+#define DATASET_SCALING_BENCH_DTYPE_SIZE sizeof(int)
+#define DATASET_SCALING_BENCH_FILE_NAME  "dataset_scaling_bench.h5"
+#define DATASET_SCALING_BENCH_DSET_NAME  "dataset_scaling_bench_dset"
+static int
+test_dataset_scaling_benchmark(void)
+{
+    hsize_t global_nelems, local_nelems, local_offset;
+    hsize_t dims[1];
+    hsize_t i;
+    double  start_time;
+    double  write_time, read_time;
+    double  local_mib;
+    hid_t   file_id       = H5I_INVALID_HID;
+    hid_t   fapl_id       = H5I_INVALID_HID;
+    hid_t   dset_id       = H5I_INVALID_HID;
+    hid_t   fspace_id     = H5I_INVALID_HID;
+    hid_t   mspace_id     = H5I_INVALID_HID;
+    int     verify_failed = 0;
+    int    *buf           = NULL;
+
+    TESTING("parallel dataset I/O scaling");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file or dataset aren't supported with this connector\n");
+        return 0;
+    }
+
+    get_parallel_scaling_share(DATASET_SCALING_BENCH_BASE_NUM_ELEMS, &global_nelems, &local_nelems,
+                               &local_offset);
+
+    local_mib = (double)(local_nelems * DATASET_SCALING_BENCH_DTYPE_SIZE) / (1024.0 * 1024.0);
+
+    if (NULL == (buf = HDmalloc(MAX(local_nelems, 1) * DATASET_SCALING_BENCH_DTYPE_SIZE))) {
+        H5_FAILED();
+        HDprintf("    couldn't allocate buffer for dataset I/O\n");
+        goto error;
+    }
+
+    for (i = 0; i < local_nelems; i++)
+        buf[i] = (int)((local_offset + i) % (hsize_t)INT_MAX);
+
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, h5_io_info_g, TRUE)) < 0)
+        TEST_ERROR;
+
+    if ((file_id = H5Fcreate(DATASET_SCALING_BENCH_FILE_NAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create file '%s'\n", DATASET_SCALING_BENCH_FILE_NAME);
+        goto error;
+    }
+
+    dims[0] = global_nelems;
+
+    if ((fspace_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+
+    if ((dset_id = H5Dcreate2(file_id, DATASET_SCALING_BENCH_DSET_NAME, DATASET_SCALING_BENCH_DSET_DTYPE,
+                              fspace_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create dataset '%s'\n", DATASET_SCALING_BENCH_DSET_NAME);
+        goto error;
+    }
+
+    /*
+     * With strong scaling, there may be more ranks than
+     * elements, leaving some ranks with nothing to do.
+     */
+    if (local_nelems > 0) {
+        if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, &local_offset, NULL, &local_nelems, NULL) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't select hyperslab for dataset I/O\n");
+            goto error;
+        }
+    }
+    else if (H5Sselect_none(fspace_id) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't set empty selection for dataset I/O\n");
+        goto error;
+    }
+
+    if ((mspace_id = H5Screate_simple(1, &local_nelems, NULL)) < 0)
+        TEST_ERROR;
+
+    if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+        H5_FAILED();
+        HDprintf("    MPI_Barrier failed\n");
+        goto error;
+    }
+
+    start_time = get_wall_time();
+
+    if (H5Dwrite(dset_id, DATASET_SCALING_BENCH_DSET_DTYPE, mspace_id, fspace_id, par_dataset_dxpl_id_g,
+                 buf) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't write to dataset '%s'\n", DATASET_SCALING_BENCH_DSET_NAME);
+        goto error;
+    }
+
+    write_time = get_wall_time() - start_time;
+
+    HDmemset(buf, 0, local_nelems * DATASET_SCALING_BENCH_DTYPE_SIZE);
+
+    if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+        H5_FAILED();
+        HDprintf("    MPI_Barrier failed\n");
+        goto error;
+    }
+
+    start_time = get_wall_time();
+
+    if (H5Dread(dset_id, DATASET_SCALING_BENCH_DSET_DTYPE, mspace_id, fspace_id, par_dataset_dxpl_id_g,
+                buf) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't read from dataset '%s'\n", DATASET_SCALING_BENCH_DSET_NAME);
+        goto error;
+    }
+
+    read_time = get_wall_time() - start_time;
+
+    for (i = 0; i < local_nelems; i++)
+        if (buf[i] != (int)((local_offset + i) % (hsize_t)INT_MAX)) {
+            verify_failed = 1;
+            break;
+        }
+
+    if (MPI_SUCCESS != MPI_Allreduce(MPI_IN_PLACE, &verify_failed, 1, MPI_INT, MPI_LOR, MPI_COMM_WORLD)) {
+        H5_FAILED();
+        HDprintf("    MPI_Allreduce failed\n");
+        goto error;
+    }
+
+    if (verify_failed) {
+        H5_FAILED();
+        HDprintf("    data verification failed on at least one rank\n");
+        goto error;
+    }
+
+    HDfree(buf);
+    buf = NULL;
+
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+
+    if (H5Fdelete(DATASET_SCALING_BENCH_FILE_NAME, fapl_id) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't delete file '%s'\n", DATASET_SCALING_BENCH_FILE_NAME);
+        goto error;
+    }
+
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    if (report_parallel_scaling_timing("H5Dwrite", write_time, local_mib, "MiB") < 0)
+        return 1;
+    if (report_parallel_scaling_timing("H5Dread", read_time, local_mib, "MiB") < 0)
+        return 1;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (buf)
+            HDfree(buf);
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+/*
+ * Verifies the data in an integer dataset whose first dimension
+ * is of size mpi_size by having each MPI rank read back only the
+ * row of the first dimension that corresponds to its rank. Each
+ * rank checks its own row against the values given by the
+ * expected_value callback and the per-rank mismatch counts and
+ * checksums are then combined with a single MPI reduction, so the
+ * amount of data read by each rank doesn't grow with the number
+ * of ranks. Must be called by all MPI ranks.
+ */
+static int
+verify_par_dataset_data_distributed(hid_t dset_id, hid_t mem_type_id, int space_rank, const hsize_t *dims,
+                                    par_dataset_expected_value_func_t expected_value)
+{
+    uint64_t results[4] = {0, 0, 0, 0}; /* failed ranks, mismatches, read checksum, expected checksum */
+    hsize_t *start      = NULL;
+    hsize_t *count      = NULL;
+    hsize_t  mdims[1];
+    size_t   row_nelems;
+    size_t   i;
+    hid_t    fspace_id = H5I_INVALID_HID;
+    hid_t    mspace_id = H5I_INVALID_HID;
+    int     *read_buf  = NULL;
+
+    for (i = 1, row_nelems = 1; i < (size_t)space_rank; i++)
+        row_nelems *= dims[i];
+
+    if (NULL == (start = HDmalloc((size_t)space_rank * sizeof(hsize_t))) ||
+        NULL == (count = HDmalloc((size_t)space_rank * sizeof(hsize_t))) ||
+        NULL == (read_buf = HDmalloc(row_nelems * sizeof(int)))) {
+        HDprintf("    couldn't allocate buffers for distributed data verification on rank %d\n", mpi_rank);
+        goto error;
+    }
+
+    for (i = 0; i < (size_t)space_rank; i++) {
+        start[i] = (i == 0) ? (hsize_t)mpi_rank : 0;
+        count[i] = (i == 0) ? 1 : dims[i];
+    }
+
+    mdims[0] = (hsize_t)row_nelems;
+
+    if ((fspace_id = H5Dget_space(dset_id)) < 0) {
+        HDprintf("    couldn't get dataset dataspace on rank %d\n", mpi_rank);
+        goto error;
+    }
+
+    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0) {
+        HDprintf("    couldn't select hyperslab for dataset read on rank %d\n", mpi_rank);
+        goto error;
+    }
+
+    if ((mspace_id = H5Screate_simple(1, mdims, NULL)) < 0) {
+        HDprintf("    couldn't create memory dataspace on rank %d\n", mpi_rank);
+        goto error;
+    }
+
+    if (H5Dread(dset_id, mem_type_id, mspace_id, fspace_id, par_dataset_dxpl_id_g, read_buf) < 0) {
+        HDprintf("    couldn't read from dataset on rank %d\n", mpi_rank);
+        goto error;
+    }
+
+    /*
+     * Weight each value by its position in the dataset so
+     * that misplaced data changes the checksum as well.
+     */
+    for (i = 0; i < row_nelems; i++) {
+        uint64_t weight   = ((uint64_t)mpi_rank * row_nelems) + i + 1;
+        int      expected = expected_value((size_t)mpi_rank, i, row_nelems);
+
+        if (read_buf[i] != expected)
+            results[1]++;
+
+        results[2] += weight * (uint64_t)read_buf[i];
+        results[3] += weight * (uint64_t)expected;
+    }
+
+    goto done;
+
+error:
+    results[0] = 1;
+
+done:
+    if (MPI_SUCCESS != MPI_Allreduce(MPI_IN_PLACE, results, 4, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD)) {
+        if (MAINPROCESS)
+            HDprintf("    couldn't combine distributed data verification results\n");
+        results[0] = 1;
+    }
+
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+    }
+    H5E_END_TRY;
+
+    HDfree(read_buf);
+    HDfree(count);
+    HDfree(start);
+
+    if (results[0] > 0) {
+        if (MAINPROCESS)
+            HDprintf("    distributed data verification couldn't be performed on %llu rank(s)\n",
+                     (unsigned long long)results[0]);
+        return -1;
+    }
+
+    if (results[1] > 0 || results[2] != results[3]) {
+        if (MAINPROCESS)
+            HDprintf("    %llu element(s) didn't match the expected values (checksum 0x%llx, expected "
+                     "0x%llx)\n",
+                     (unsigned long long)results[1], (unsigned long long)results[2],
+                     (unsigned long long)results[3]);
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * Creates the DXPL for one of the DXPL variants that
+ * the parallel dataset tests are run with.
+ */
+static hid_t
+create_par_dataset_dxpl(par_dataset_dxpl_variant_t variant)
+{
+    hid_t dxpl_id = H5I_INVALID_HID;
+
+    if ((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        goto error;
+
+    switch (variant) {
+        case PAR_DATASET_DXPL_INDEPENDENT:
+            if (H5Pset_dxpl_mpio(dxpl_id, H5FD_MPIO_INDEPENDENT) < 0)
+                goto error;
+            break;
+        case PAR_DATASET_DXPL_COLLECTIVE:
+            if (H5Pset_dxpl_mpio(dxpl_id, H5FD_MPIO_COLLECTIVE) < 0)
+                goto error;
+            break;
+        case PAR_DATASET_DXPL_COLLECTIVE_LINK_CHUNK:
+            if (H5Pset_dxpl_mpio(dxpl_id, H5FD_MPIO_COLLECTIVE) < 0)
+                goto error;
+            if (H5Pset_dxpl_mpio_chunk_opt(dxpl_id, H5FD_MPIO_CHUNK_ONE_IO) < 0)
+                goto error;
+            break;
+        case PAR_DATASET_DXPL_COLLECTIVE_MULTI_CHUNK:
+            if (H5Pset_dxpl_mpio(dxpl_id, H5FD_MPIO_COLLECTIVE) < 0)
+                goto error;
+            if (H5Pset_dxpl_mpio_chunk_opt(dxpl_id, H5FD_MPIO_CHUNK_MULTI_IO) < 0)
+                goto error;
+            break;
+        case PAR_DATASET_DXPL_NUM_VARIANTS:
+        default:
+            goto error;
+    }
+
+    return dxpl_id;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dxpl_id);
+    }
+    H5E_END_TRY;
+
+    return H5I_INVALID_HID;
+}
+
+/*
+ * Reports the results of running the parallel dataset tests under
+ * each MPI-IO hint set. For each test and DXPL variant, the hint set
+ * under which the test completed fastest on the slowest rank is
+ * reported, along with its speedup over running without hints. A
+ * negative time marks a test that failed under a hint set, which is
+ * then excluded from the choice of fastest hint set. Must be called
+ * by all MPI ranks.
+ */
+static int
+report_par_dataset_hint_sweep(double *test_times, char **hint_set_descs, size_t num_hint_sets)
+{
+    size_t  num_tests = ARRAY_LENGTH(par_dataset_tests);
+    size_t  num_times = (num_hint_sets + 1) * PAR_DATASET_DXPL_NUM_VARIANTS * num_tests;
+    size_t  h, i, j;
+    double *min_times = NULL;
+
+    if (NULL == (min_times = HDmalloc(num_times * sizeof(*min_times)))) {
+        if (MAINPROCESS)
+            HDprintf("    couldn't allocate buffer for MPI-IO hint sweep timings\n");
+        return -1;
+    }
+
+    /*
+     * The time a test took is the time taken by the slowest rank,
+     * while a test failed if it failed on any rank
+     */
+    if (MPI_SUCCESS != MPI_Allreduce(test_times, min_times, (int)num_times, MPI_DOUBLE, MPI_MIN,
+                                     MPI_COMM_WORLD) ||
+        MPI_SUCCESS != MPI_Allreduce(MPI_IN_PLACE, test_times, (int)num_times, MPI_DOUBLE, MPI_MAX,
+                                     MPI_COMM_WORLD)) {
+        if (MAINPROCESS)
+            HDprintf("    couldn't collect MPI-IO hint sweep timings from all ranks\n");
+        HDfree(min_times);
+        return -1;
+    }
+
+    for (i = 0; i < num_times; i++)
+        if (min_times[i] < 0.0)
+            test_times[i] = -1.0;
+
+    HDfree(min_times);
+
+    if (!MAINPROCESS)
+        return 0;
+
+    HDprintf("MPI-IO hint sweep results:\n");
+    HDprintf("  hint set 0: no hints\n");
+    for (h = 0; h < num_hint_sets; h++)
+        HDprintf("  hint set %zu: %s\n", h + 1, hint_set_descs[h]);
+
+    for (i = 0; i < PAR_DATASET_DXPL_NUM_VARIANTS; i++) {
+        HDprintf("\n  Fastest hint set per test with %s:\n", par_dataset_dxpl_variant_names[i]);
+
+        for (j = 0; j < num_tests; j++) {
+            double baseline_time = test_times[(i * num_tests) + j];
+            double best_time     = -1.0;
+            size_t best_set      = 0;
+
+            for (h = 0; h <= num_hint_sets; h++) {
+                double time = test_times[(((h * PAR_DATASET_DXPL_NUM_VARIANTS) + i) * num_tests) + j];
+
+                if (time >= 0.0 && (best_time < 0.0 || time < best_time)) {
+                    best_time = time;
+                    best_set  = h;
+                }
+            }
+
+            if (best_time < 0.0)
+                HDprintf("    %-45s: failed under all hint sets\n", par_dataset_test_names[j]);
+            else if (baseline_time < 0.0)
+                HDprintf("    %-45s: hint set %zu (%.6f s, failed with no hints)\n",
+                         par_dataset_test_names[j], best_set, best_time);
+            else
+                HDprintf("    %-45s: hint set %zu (%.6f s, %.2fx vs. no hints)\n", par_dataset_test_names[j],
+                         best_set, best_time, (best_time > 0.0) ? baseline_time / best_time : 1.0);
+        }
+    }
+
+    HDprintf("\n");
+
+    return 0;
+}
+
 int
 vol_dataset_test_parallel(void)
 {
-    size_t i;
-    int    nerrors;
+    MPI_Info   *hint_sets      = NULL;
+    const char *hints_filename = NULL;
+    char      **hint_set_descs = NULL;
+    double     *test_times     = NULL;
+    size_t      num_hint_sets  = 0;
+    size_t      h, i, j;
+    hbool_t     use_variant_file;
+    double      start_time;
+    char        orig_filename[VOL_TEST_FILENAME_MAX_LENGTH];
+    int         nerrors = 0;
 
     if (MAINPROCESS) {
         HDprintf("**********************************************\n");
@@ -8133,17 +8722,139 @@ vol_dataset_test_parallel(void)
         HDprintf("**********************************************\n\n");
     }
 
-    for (i = 0, nerrors = 0; i < ARRAY_LENGTH(par_dataset_tests); i++) {
-        nerrors += (*par_dataset_tests[i])() ? 1 : 0;
+    par_dataset_distributed_verify_g = (NULL != HDgetenv(HDF5_API_TEST_DISTRIBUTED_VERIFY));
 
-        if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+    if (MAINPROCESS && par_dataset_distributed_verify_g)
+        HDprintf("Using distributed data verification\n\n");
+
+    HDsnprintf(orig_filename, sizeof(orig_filename), "%s", vol_test_parallel_filename);
+
+    if (NULL != (hints_filename = HDgetenv(HDF5_API_TEST_MPIO_HINTS_FILE))) {
+        if (load_mpio_hint_sets(hints_filename, &hint_sets, &hint_set_descs, &num_hint_sets) < 0) {
             if (MAINPROCESS)
-                HDprintf("    MPI_Barrier() failed!\n");
+                HDprintf("    couldn't load MPI-IO hint sets from file '%s'\n", hints_filename);
+            goto error;
         }
+
+        if (MAINPROCESS)
+            HDprintf("Running parallel dataset tests without MPI-IO hints and under %zu hint set(s) from "
+                     "'%s'\n\n",
+                     num_hint_sets, hints_filename);
+    }
+
+    if (NULL == (test_times = HDcalloc((num_hint_sets + 1) * PAR_DATASET_DXPL_NUM_VARIANTS *
+                                           ARRAY_LENGTH(par_dataset_tests),
+                                       sizeof(double)))) {
+        if (MAINPROCESS)
+            HDprintf("    couldn't allocate buffer for test timings\n");
+        goto error;
     }
 
+    for (h = 0; h <= num_hint_sets; h++) {
+        h5_io_info_g = (h == 0) ? MPI_INFO_NULL : hint_sets[h - 1];
+
+        if (MAINPROCESS && num_hint_sets > 0)
+            HDprintf("Running parallel dataset tests with %s%s\n\n", (h == 0) ? "no MPI-IO hints" : "hints ",
+                     (h == 0) ? "" : hint_set_descs[h - 1]);
+
+        for (i = 0; i < PAR_DATASET_DXPL_NUM_VARIANTS; i++) {
+            use_variant_file = (h > 0 || i > 0);
+
+            if (use_variant_file) {
+                HDsnprintf(vol_test_parallel_filename, VOL_TEST_FILENAME_MAX_LENGTH, "%s%s", test_path_prefix,
+                           PAR_DATASET_DXPL_VARIANT_FILE_NAME);
+
+                BEGIN_INDEPENDENT_OP(create_test_container)
+                {
+                    if (MAINPROCESS) {
+                        if (create_test_container(vol_test_parallel_filename, vol_cap_flags_g) < 0) {
+                            HDprintf("    failed to create testing container file '%s'\n",
+                                     vol_test_parallel_filename);
+                            INDEPENDENT_OP_ERROR(create_test_container);
+                        }
+                    }
+                }
+                END_INDEPENDENT_OP(create_test_container);
+            }
+
+            if ((par_dataset_dxpl_id_g = create_par_dataset_dxpl((par_dataset_dxpl_variant_t)i)) < 0) {
+                if (MAINPROCESS)
+                    HDprintf("    couldn't create DXPL for %s\n", par_dataset_dxpl_variant_names[i]);
+                goto error;
+            }
+
+            if (MAINPROCESS)
+                HDprintf("Running parallel dataset tests with %s\n\n", par_dataset_dxpl_variant_names[i]);
+
+            start_time = get_wall_time();
+
+            for (j = 0; j < ARRAY_LENGTH(par_dataset_tests); j++) {
+                double test_start_time = get_wall_time();
+                int    test_ret;
+
+                test_ret = run_parallel_test(par_dataset_tests[j]);
+                nerrors += test_ret ? 1 : 0;
+
+                /* Record a failed test with a negative time */
+                test_times[(((h * PAR_DATASET_DXPL_NUM_VARIANTS) + i) * ARRAY_LENGTH(par_dataset_tests)) +
+                           j] = test_ret ? -1.0 : get_wall_time() - test_start_time;
+
+                if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+                    if (MAINPROCESS)
+                        HDprintf("    MPI_Barrier() failed!\n");
+                }
+            }
+
+            if (MAINPROCESS)
+                HDprintf("\nParallel dataset tests with %s took %.6f s\n\n",
+                         par_dataset_dxpl_variant_names[i], get_wall_time() - start_time);
+
+            if (H5Pclose(par_dataset_dxpl_id_g) < 0) {
+                if (MAINPROCESS)
+                    HDprintf("    couldn't close DXPL for %s\n", par_dataset_dxpl_variant_names[i]);
+                goto error;
+            }
+            par_dataset_dxpl_id_g = H5P_DEFAULT;
+
+            if (use_variant_file) {
+                if (MAINPROCESS)
+                    remove_test_file(test_path_prefix, PAR_DATASET_DXPL_VARIANT_FILE_NAME);
+
+                HDsnprintf(vol_test_parallel_filename, VOL_TEST_FILENAME_MAX_LENGTH, "%s", orig_filename);
+            }
+        }
+    }
+
+    h5_io_info_g = MPI_INFO_NULL;
+
+    if (num_hint_sets > 0 && report_par_dataset_hint_sweep(test_times, hint_set_descs, num_hint_sets) < 0)
+        nerrors++;
+
+    HDfree(test_times);
+    free_mpio_hint_sets(hint_sets, hint_set_descs, num_hint_sets);
+
     if (MAINPROCESS)
         HDprintf("\n");
 
     return nerrors;
+
+error:
+    if (par_dataset_dxpl_id_g != H5P_DEFAULT) {
+        H5E_BEGIN_TRY
+        {
+            H5Pclose(par_dataset_dxpl_id_g);
+        }
+        H5E_END_TRY;
+        par_dataset_dxpl_id_g = H5P_DEFAULT;
+    }
+
+    h5_io_info_g = MPI_INFO_NULL;
+
+    if (test_times)
+        HDfree(test_times);
+    free_mpio_hint_sets(hint_sets, hint_set_descs, num_hint_sets);
+
+    HDsnprintf(vol_test_parallel_filename, VOL_TEST_FILENAME_MAX_LENGTH, "%s", orig_filename);
+
+    return nerrors + 1;
 }
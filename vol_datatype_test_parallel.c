@@ -12,10 +12,313 @@
 
 #include "vol_datatype_test_parallel.h"
 
+static int test_commit_open_shared_compound_types(void);
+
+static hid_t create_par_datatype_compound_type(void);
+
 /*
  * The array of parallel datatype tests to be performed.
  */
-static int (*par_datatype_tests[])(void) = {NULL};
+static int (*par_datatype_tests[])(void) = {
+    test_commit_open_shared_compound_types,
+};
+
+/*
+ * A test to check that compound datatypes can be collectively
+ * committed and then opened by all MPI ranks, as happens when many
+ * datasets share a set of committed types. The committed types are
+ * opened with collective and then with independent metadata reads
+ * and the time taken for each class of operation is reported.
+ */
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define DATATYPE_SHARED_COMPOUND_TEST_NUM_TYPES      100
+#define DATATYPE_SHARED_COMPOUND_TEST_NUM_OPEN_ITERS 100
+#else
+#define DATATYPE_SHARED_COMPOUND_TEST_NUM_TYPES      8
+#define DATATYPE_SHARED_COMPOUND_TEST_NUM_OPEN_ITERS 4
+#endif
+#define DATATYPE_SHARED_COMPOUND_TEST_GROUP_NAME    "shared_compound_type_test"
+#define DATATYPE_SHARED_COMPOUND_TEST_NAME_BUF_SIZE 64
+static int
+test_commit_open_shared_compound_types(void)
+{
+    size_t i, j, k;
+    double start_time;
+    double commit_time, open_time;
+    char   type_name[DATATYPE_SHARED_COMPOUND_TEST_NAME_BUF_SIZE];
+    hid_t  file_id         = H5I_INVALID_HID;
+    hid_t  fapl_id         = H5I_INVALID_HID;
+    hid_t  container_group = H5I_INVALID_HID;
+    hid_t  group_id        = H5I_INVALID_HID;
+    hid_t  type_id         = H5I_INVALID_HID;
+    hid_t  ref_type_id     = H5I_INVALID_HID;
+
+    TESTING_MULTIPART("collective commit and all-rank open of shared compound datatypes");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_STORED_DATATYPES)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file, group, or stored datatype aren't supported with this "
+                 "connector\n");
+        return 0;
+    }
+
+    TESTING_2("test setup");
+
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+        TEST_ERROR;
+
+    if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open file '%s'\n", vol_test_parallel_filename);
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, DATATYPE_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open container group '%s'\n", DATATYPE_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((group_id = H5Gcreate2(container_group, DATATYPE_SHARED_COMPOUND_TEST_GROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create container sub-group '%s'\n", DATATYPE_SHARED_COMPOUND_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((ref_type_id = create_par_datatype_compound_type()) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create compound datatype\n");
+        goto error;
+    }
+
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR;
+    container_group = H5I_INVALID_HID;
+
+    PASSED();
+
+    BEGIN_MULTIPART
+    {
+        PART_BEGIN(H5Tcommit2_collective)
+        {
+            TESTING_2("H5Tcommit2 by all ranks");
+
+            commit_time = 0.0;
+
+            if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+                H5_FAILED();
+                HDprintf("    MPI_Barrier failed\n");
+                PART_ERROR(H5Tcommit2_collective);
+            }
+
+            for (i = 0; i < DATATYPE_SHARED_COMPOUND_TEST_NUM_TYPES; i++) {
+                HDsnprintf(type_name, DATATYPE_SHARED_COMPOUND_TEST_NAME_BUF_SIZE, "compound_type%zu", i);
+
+                if ((type_id = H5Tcopy(ref_type_id)) < 0) {
+                    H5_FAILED();
+                    HDprintf("    couldn't copy compound datatype\n");
+                    PART_ERROR(H5Tcommit2_collective);
+                }
+
+                start_time = get_wall_time();
+
+                if (H5Tcommit2(group_id, type_name, type_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT) < 0) {
+                    H5_FAILED();
+                    HDprintf("    couldn't commit datatype '%s'\n", type_name);
+                    PART_ERROR(H5Tcommit2_collective);
+                }
+
+                commit_time += get_wall_time() - start_time;
+
+                if (H5Tclose(type_id) < 0) {
+                    H5_FAILED();
+                    HDprintf("    couldn't close datatype '%s'\n", type_name);
+                    PART_ERROR(H5Tcommit2_collective);
+                }
+                type_id = H5I_INVALID_HID;
+            }
+
+            PASSED();
+
+            if (report_parallel_collective_timing("H5Tcommit2", commit_time,
+                                                  (double)DATATYPE_SHARED_COMPOUND_TEST_NUM_TYPES,
+                                                  "datatypes") < 0)
+                PART_ERROR(H5Tcommit2_collective);
+        }
+        PART_END(H5Tcommit2_collective);
+
+        if (type_id >= 0) {
+            H5E_BEGIN_TRY
+            {
+                H5Tclose(type_id);
+            }
+            H5E_END_TRY;
+            type_id = H5I_INVALID_HID;
+        }
+
+        /*
+         * Open the committed datatypes on all ranks with collective
+         * metadata reads, then again with independent metadata reads,
+         * re-opening the file each time so that the opens aren't
+         * satisfied from metadata that is already cached.
+         */
+        for (j = 0; j < 2; j++) {
+            hbool_t coll_md_read = (j == 0) ? TRUE : FALSE;
+
+            PART_BEGIN(H5Topen2_all_ranks)
+            {
+                TESTING_2(coll_md_read ? "H5Topen2 by all ranks with collective metadata reads"
+                                       : "H5Topen2 by all ranks with independent metadata reads");
+
+                open_time = 0.0;
+
+                if (reopen_parallel_test_group(coll_md_read,
+                                               "/" DATATYPE_TEST_GROUP_NAME
+                                               "/" DATATYPE_SHARED_COMPOUND_TEST_GROUP_NAME,
+                                               &fapl_id, &file_id, &group_id) < 0) {
+                    H5_FAILED();
+                    PART_ERROR(H5Topen2_all_ranks);
+                }
+
+                for (k = 0; k < DATATYPE_SHARED_COMPOUND_TEST_NUM_OPEN_ITERS; k++) {
+                    for (i = 0; i < DATATYPE_SHARED_COMPOUND_TEST_NUM_TYPES; i++) {
+                        htri_t types_equal;
+
+                        HDsnprintf(type_name, DATATYPE_SHARED_COMPOUND_TEST_NAME_BUF_SIZE, "compound_type%zu",
+                                   i);
+
+                        start_time = get_wall_time();
+
+                        if ((type_id = H5Topen2(group_id, type_name, H5P_DEFAULT)) < 0) {
+                            H5_FAILED();
+                            HDprintf("    couldn't open committed datatype '%s'\n", type_name);
+                            PART_ERROR(H5Topen2_all_ranks);
+                        }
+
+                        open_time += get_wall_time() - start_time;
+
+                        if ((types_equal = H5Tequal(type_id, ref_type_id)) < 0) {
+                            H5_FAILED();
+                            HDprintf("    couldn't compare committed datatype '%s'\n", type_name);
+                            PART_ERROR(H5Topen2_all_ranks);
+                        }
+
+                        if (!types_equal) {
+                            H5_FAILED();
+                            HDprintf("    committed datatype '%s' didn't match the original datatype\n",
+                                     type_name);
+                            PART_ERROR(H5Topen2_all_ranks);
+                        }
+
+                        if (H5Tclose(type_id) < 0) {
+                            H5_FAILED();
+                            HDprintf("    couldn't close committed datatype '%s'\n", type_name);
+                            PART_ERROR(H5Topen2_all_ranks);
+                        }
+                        type_id = H5I_INVALID_HID;
+                    }
+                }
+
+                PASSED();
+
+                /* Every rank opens every datatype */
+                if (report_parallel_scaling_timing("H5Topen2", open_time,
+                                                   (double)(DATATYPE_SHARED_COMPOUND_TEST_NUM_TYPES *
+                                                            DATATYPE_SHARED_COMPOUND_TEST_NUM_OPEN_ITERS),
+                                                   "datatypes") < 0)
+                    PART_ERROR(H5Topen2_all_ranks);
+            }
+            PART_END(H5Topen2_all_ranks);
+
+            if (type_id >= 0) {
+                H5E_BEGIN_TRY
+                {
+                    H5Tclose(type_id);
+                }
+                H5E_END_TRY;
+                type_id = H5I_INVALID_HID;
+            }
+        }
+    }
+    END_MULTIPART;
+
+    TESTING_2("test cleanup");
+
+    if (H5Tclose(ref_type_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Tclose(type_id);
+        H5Tclose(ref_type_id);
+        H5Gclose(group_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+/*
+ * Creates the compound datatype that is committed by the parallel
+ * datatype tests. Unlike generate_random_datatype(), the datatype
+ * must be the same on every MPI rank, so it is fixed here.
+ */
+static hid_t
+create_par_datatype_compound_type(void)
+{
+    hid_t type_id     = H5I_INVALID_HID;
+    hid_t str_type_id = H5I_INVALID_HID;
+
+    if ((str_type_id = H5Tcopy(H5T_C_S1)) < 0)
+        goto error;
+    if (H5Tset_size(str_type_id, 16) < 0)
+        goto error;
+
+    if ((type_id = H5Tcreate(H5T_COMPOUND, sizeof(int) + sizeof(double) + sizeof(long long) + 16)) < 0)
+        goto error;
+
+    if (H5Tinsert(type_id, "int_field", 0, H5T_NATIVE_INT) < 0)
+        goto error;
+    if (H5Tinsert(type_id, "double_field", sizeof(int), H5T_NATIVE_DOUBLE) < 0)
+        goto error;
+    if (H5Tinsert(type_id, "llong_field", sizeof(int) + sizeof(double), H5T_NATIVE_LLONG) < 0)
+        goto error;
+    if (H5Tinsert(type_id, "string_field", sizeof(int) + sizeof(double) + sizeof(long long), str_type_id) <
+        0)
+        goto error;
+
+    if (H5Tclose(str_type_id) < 0)
+        goto error;
+
+    return type_id;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Tclose(str_type_id);
+        H5Tclose(type_id);
+    }
+    H5E_END_TRY;
+
+    return H5I_INVALID_HID;
+}
 
 int
 vol_datatype_test_parallel(void)
@@ -32,7 +335,7 @@ vol_datatype_test_parallel(void)
     }
 
     for (i = 0, nerrors = 0; i < ARRAY_LENGTH(par_datatype_tests); i++) {
-        /* nerrors += (*par_datatype_tests[i])() ? 1 : 0; */
+        nerrors += run_parallel_test(par_datatype_tests[i]) ? 1 : 0;
 
         if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
             if (MAINPROCESS)
@@ -29,6 +29,13 @@ static int test_get_file_intent(void);
 static int test_get_file_obj_count(void);
 static int test_file_mounts(void);
 static int test_get_file_name(void);
+static int test_file_open_close_benchmark(void);
+static int test_file_many_open_benchmark(void);
+
+static int  file_open_close_bench_run(const char *filename, size_t num_groups, double *create_time_out,
+                                      double *close_time_out, double *open_timings, double *reopen_timings,
+                                      double *close_timings, hsize_t *file_size_out);
+static void file_bench_report_latency(const char *op_name, double *timings, size_t ntimings);
 
 /*
  * The array of file tests to be performed.
@@ -51,6 +58,8 @@ static int (*file_tests[])(void) = {
     test_get_file_obj_count,
     test_file_mounts,
     test_get_file_name,
+    test_file_open_close_benchmark,
+    test_file_many_open_benchmark,
 };
 
 /*
@@ -2491,6 +2500,496 @@ error:
     return 1;
 }
 
+/*
+ * A benchmark to measure the latency of creating, opening, re-opening
+ * and closing a file as the amount of metadata in the file grows. For
+ * each number of groups, a file containing that many groups is created
+ * and then repeatedly opened, re-opened with H5Freopen and closed.
+ */
+static int
+test_file_open_close_benchmark(void)
+{
+    hsize_t file_size      = 0;
+    size_t  group_counts[] = FILE_OPEN_CLOSE_BENCH_GROUP_COUNTS;
+    size_t  i;
+    double  create_time       = 0.0;
+    double  first_close_time  = 0.0;
+    double *open_timings      = NULL;
+    double *reopen_timings    = NULL;
+    double *close_timings     = NULL;
+    char   *prefixed_filename = NULL;
+
+    TESTING_MULTIPART("file open/close latency benchmark");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_MORE) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC)) {
+        SKIPPED();
+        HDprintf("    API functions for basic or more file, or basic group aren't supported with this "
+                 "connector\n");
+        return 0;
+    }
+
+    TESTING_2("test setup");
+
+    if (prefix_filename(test_path_prefix, FILE_OPEN_CLOSE_BENCH_FILENAME, &prefixed_filename) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't prefix filename\n");
+        goto error;
+    }
+
+    if (NULL == (open_timings = HDmalloc(FILE_OPEN_CLOSE_BENCH_NUM_ITERS * sizeof(*open_timings))))
+        TEST_ERROR;
+    if (NULL == (reopen_timings = HDmalloc(FILE_OPEN_CLOSE_BENCH_NUM_ITERS * sizeof(*reopen_timings))))
+        TEST_ERROR;
+    if (NULL == (close_timings = HDmalloc(FILE_OPEN_CLOSE_BENCH_NUM_ITERS * sizeof(*close_timings))))
+        TEST_ERROR;
+
+    PASSED();
+
+    BEGIN_MULTIPART
+    {
+        for (i = 0; i < ARRAY_LENGTH(group_counts); i++) {
+            PART_BEGIN(open_close)
+            {
+                char test_name[128];
+
+                HDsnprintf(test_name, sizeof(test_name), "create, open and close of file with %zu groups",
+                           group_counts[i]);
+
+                TESTING_2(test_name);
+
+                if (file_open_close_bench_run(prefixed_filename, group_counts[i], &create_time,
+                                              &first_close_time, open_timings, reopen_timings,
+                                              close_timings, &file_size) < 0)
+                    PART_TEST_ERROR(open_close);
+
+                PASSED();
+
+                HDprintf("    file size: %llu bytes; H5Fcreate: %.2f us, H5Fclose after creating groups: "
+                         "%.2f us\n",
+                         (unsigned long long)file_size, create_time * 1.0E6, first_close_time * 1.0E6);
+                file_bench_report_latency("H5Fopen", open_timings, FILE_OPEN_CLOSE_BENCH_NUM_ITERS);
+                file_bench_report_latency("H5Freopen", reopen_timings, FILE_OPEN_CLOSE_BENCH_NUM_ITERS);
+                file_bench_report_latency("H5Fclose", close_timings, FILE_OPEN_CLOSE_BENCH_NUM_ITERS);
+            }
+            PART_END(open_close);
+        }
+    }
+    END_MULTIPART;
+
+    TESTING_2("test cleanup");
+
+    HDfree(open_timings);
+    open_timings = NULL;
+    HDfree(reopen_timings);
+    reopen_timings = NULL;
+    HDfree(close_timings);
+    close_timings = NULL;
+
+    HDfree(prefixed_filename);
+    prefixed_filename = NULL;
+
+    PASSED();
+
+    return 0;
+
+error:
+    HDfree(open_timings);
+    HDfree(reopen_timings);
+    HDfree(close_timings);
+    HDfree(prefixed_filename);
+
+    return 1;
+}
+
+/*
+ * Helper for the file open/close benchmark which creates a file
+ * containing 'num_groups' groups and then opens, re-opens and
+ * closes it FILE_OPEN_CLOSE_BENCH_NUM_ITERS times, recording the
+ * time taken by each call.
+ */
+static int
+file_open_close_bench_run(const char *filename, size_t num_groups, double *create_time_out,
+                          double *close_time_out, double *open_timings, double *reopen_timings,
+                          double *close_timings, hsize_t *file_size_out)
+{
+    size_t i;
+    double start_time;
+    hid_t  file_id   = H5I_INVALID_HID;
+    hid_t  file_id2  = H5I_INVALID_HID;
+    hid_t  group_id  = H5I_INVALID_HID;
+    char   group_name[64];
+    int    ret_value = -1;
+
+    start_time = get_wall_time();
+
+    if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        HDprintf("    couldn't create file '%s'\n", filename);
+        goto done;
+    }
+
+    *create_time_out = get_wall_time() - start_time;
+
+    for (i = 0; i < num_groups; i++) {
+        HDsnprintf(group_name, sizeof(group_name), "group%zu", i);
+
+        if ((group_id = H5Gcreate2(file_id, group_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+            HDprintf("    couldn't create group '%s'\n", group_name);
+            goto done;
+        }
+
+        if (H5Gclose(group_id) < 0)
+            goto done;
+        group_id = H5I_INVALID_HID;
+    }
+
+    start_time = get_wall_time();
+
+    if (H5Fclose(file_id) < 0) {
+        HDprintf("    couldn't close file '%s'\n", filename);
+        goto done;
+    }
+    file_id = H5I_INVALID_HID;
+
+    *close_time_out = get_wall_time() - start_time;
+
+    for (i = 0; i < FILE_OPEN_CLOSE_BENCH_NUM_ITERS; i++) {
+        start_time = get_wall_time();
+
+        if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0) {
+            HDprintf("    couldn't open file '%s'\n", filename);
+            goto done;
+        }
+
+        open_timings[i] = get_wall_time() - start_time;
+        start_time      = get_wall_time();
+
+        if ((file_id2 = H5Freopen(file_id)) < 0) {
+            HDprintf("    couldn't re-open file '%s'\n", filename);
+            goto done;
+        }
+
+        reopen_timings[i] = get_wall_time() - start_time;
+
+        if (i == 0 && H5Fget_filesize(file_id, file_size_out) < 0) {
+            HDprintf("    couldn't retrieve size of file '%s'\n", filename);
+            goto done;
+        }
+
+        if (H5Fclose(file_id2) < 0) {
+            HDprintf("    couldn't close re-opened file '%s'\n", filename);
+            goto done;
+        }
+        file_id2 = H5I_INVALID_HID;
+
+        start_time = get_wall_time();
+
+        if (H5Fclose(file_id) < 0) {
+            HDprintf("    couldn't close file '%s'\n", filename);
+            goto done;
+        }
+        file_id = H5I_INVALID_HID;
+
+        close_timings[i] = get_wall_time() - start_time;
+    }
+
+    ret_value = 0;
+
+done:
+    H5E_BEGIN_TRY
+    {
+        H5Gclose(group_id);
+        H5Fclose(file_id2);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    return ret_value;
+}
+
+/*
+ * A benchmark to measure the throughput of opening and closing a large
+ * number of files that are all kept open at the same time, as happens
+ * when following the external links of a catalog file, along with the
+ * overhead of H5Fget_obj_count while those files are open. The number
+ * of files is reduced if it would exceed the limit on the number of open
+ * file descriptors.
+ */
+static int
+test_file_many_open_benchmark(void)
+{
+    ssize_t obj_count;
+    size_t  num_files = FILE_MANY_OPEN_BENCH_NUM_FILES;
+    size_t  i;
+    double  start_time;
+    double  create_time     = 0.0;
+    double  open_time       = 0.0;
+    double  close_time      = 0.0;
+    double  obj_count_time  = 0.0;
+    double *open_timings    = NULL;
+    double *close_timings   = NULL;
+    hid_t  *file_ids        = NULL;
+    char  **filenames       = NULL;
+
+    TESTING_MULTIPART("many open files benchmark");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_MORE)) {
+        SKIPPED();
+        HDprintf("    API functions for basic or more file aren't supported with this connector\n");
+        return 0;
+    }
+
+    TESTING_2("test setup");
+
+#ifdef H5_HAVE_SYS_RESOURCE_H
+    {
+        struct rlimit rlim;
+
+        /* Leave some file descriptors free for the rest of the test program */
+        if (getrlimit(RLIMIT_NOFILE, &rlim) == 0 && rlim.rlim_cur != RLIM_INFINITY &&
+            (rlim_t)(num_files + FILE_MANY_OPEN_BENCH_FD_RESERVE) > rlim.rlim_cur) {
+            if (rlim.rlim_cur <= (rlim_t)FILE_MANY_OPEN_BENCH_FD_RESERVE) {
+                SKIPPED();
+                HDprintf("    limit on open file descriptors (%llu) is too low for this test\n",
+                         (unsigned long long)rlim.rlim_cur);
+                return 0;
+            }
+
+            num_files = (size_t)rlim.rlim_cur - FILE_MANY_OPEN_BENCH_FD_RESERVE;
+        }
+    }
+#endif
+
+    if (NULL == (file_ids = HDmalloc(num_files * sizeof(*file_ids))))
+        TEST_ERROR;
+    for (i = 0; i < num_files; i++)
+        file_ids[i] = H5I_INVALID_HID;
+
+    if (NULL == (filenames = HDcalloc(num_files, sizeof(*filenames))))
+        TEST_ERROR;
+    if (NULL == (open_timings = HDmalloc(num_files * sizeof(*open_timings))))
+        TEST_ERROR;
+    if (NULL == (close_timings = HDmalloc(num_files * sizeof(*close_timings))))
+        TEST_ERROR;
+
+    for (i = 0; i < num_files; i++) {
+        char filename[64];
+
+        HDsnprintf(filename, sizeof(filename), "%s%zu.h5", FILE_MANY_OPEN_BENCH_FILENAME_PREFIX, i);
+
+        if (prefix_filename(test_path_prefix, filename, &filenames[i]) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't prefix filename\n");
+            goto error;
+        }
+    }
+
+    start_time = get_wall_time();
+
+    for (i = 0; i < num_files; i++) {
+        if ((file_ids[i] = H5Fcreate(filenames[i], H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't create file '%s'\n", filenames[i]);
+            goto error;
+        }
+
+        if (H5Fclose(file_ids[i]) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't close file '%s'\n", filenames[i]);
+            goto error;
+        }
+        file_ids[i] = H5I_INVALID_HID;
+    }
+
+    create_time = get_wall_time() - start_time;
+
+    PASSED();
+
+    HDprintf("    created %zu files in %.6f s (%.0f files/s)\n", num_files, create_time,
+             (create_time > 0.0) ? (double)num_files / create_time : 0.0);
+
+    BEGIN_MULTIPART
+    {
+        PART_BEGIN(open_many_files)
+        {
+            TESTING_2("H5Fopen of many files kept open together");
+
+            for (i = 0; i < num_files; i++) {
+                start_time = get_wall_time();
+
+                if ((file_ids[i] = H5Fopen(filenames[i], H5F_ACC_RDONLY, H5P_DEFAULT)) < 0) {
+                    H5_FAILED();
+                    HDprintf("    couldn't open file '%s'\n", filenames[i]);
+                    PART_ERROR(open_many_files);
+                }
+
+                open_timings[i] = get_wall_time() - start_time;
+                open_time += open_timings[i];
+            }
+
+            PASSED();
+
+            HDprintf("    opened %zu files in %.6f s (%.0f files/s)\n", num_files, open_time,
+                     (open_time > 0.0) ? (double)num_files / open_time : 0.0);
+            file_bench_report_latency("H5Fopen", open_timings, num_files);
+        }
+        PART_END(open_many_files);
+
+        PART_BEGIN(H5Fget_obj_count_many_files)
+        {
+            TESTING_2("H5Fget_obj_count with many open files");
+
+            /* All files need to be open for this part */
+            for (i = 0; i < num_files; i++) {
+                if (file_ids[i] < 0) {
+                    SKIPPED();
+                    HDprintf("    not all files were opened\n");
+                    PART_EMPTY(H5Fget_obj_count_many_files);
+                }
+            }
+
+            start_time = get_wall_time();
+
+            for (i = 0; i < FILE_MANY_OPEN_BENCH_OBJ_COUNT_ITERS; i++) {
+                if ((obj_count = H5Fget_obj_count((hid_t)H5F_OBJ_ALL, H5F_OBJ_FILE)) < 0) {
+                    H5_FAILED();
+                    HDprintf("    couldn't get the number of open files\n");
+                    PART_ERROR(H5Fget_obj_count_many_files);
+                }
+            }
+
+            obj_count_time = (get_wall_time() - start_time) / FILE_MANY_OPEN_BENCH_OBJ_COUNT_ITERS;
+
+            if ((size_t)obj_count != num_files) {
+                H5_FAILED();
+                HDprintf("    number of open files (%ld) did not match expected number (%zu)\n", obj_count,
+                         num_files);
+                PART_ERROR(H5Fget_obj_count_many_files);
+            }
+
+            PASSED();
+
+            HDprintf("    H5Fget_obj_count over all files: %.2f us per call\n", obj_count_time * 1.0E6);
+
+            start_time = get_wall_time();
+
+            for (i = 0; i < FILE_MANY_OPEN_BENCH_OBJ_COUNT_ITERS; i++) {
+                if ((obj_count = H5Fget_obj_count(file_ids[0], H5F_OBJ_ALL)) < 0) {
+                    H5_FAILED();
+                    HDprintf("    couldn't get the number of open objects in file\n");
+                    PART_ERROR(H5Fget_obj_count_many_files);
+                }
+            }
+
+            obj_count_time = (get_wall_time() - start_time) / FILE_MANY_OPEN_BENCH_OBJ_COUNT_ITERS;
+
+            HDprintf("    H5Fget_obj_count for a single file: %.2f us per call\n", obj_count_time * 1.0E6);
+        }
+        PART_END(H5Fget_obj_count_many_files);
+
+        PART_BEGIN(close_many_files)
+        {
+            TESTING_2("H5Fclose of many open files");
+
+            for (i = 0; i < num_files; i++) {
+                if (file_ids[i] < 0) {
+                    SKIPPED();
+                    HDprintf("    not all files were opened\n");
+                    PART_EMPTY(close_many_files);
+                }
+            }
+
+            for (i = 0; i < num_files; i++) {
+                start_time = get_wall_time();
+
+                if (H5Fclose(file_ids[i]) < 0) {
+                    H5_FAILED();
+                    HDprintf("    couldn't close file '%s'\n", filenames[i]);
+                    PART_ERROR(close_many_files);
+                }
+                file_ids[i] = H5I_INVALID_HID;
+
+                close_timings[i] = get_wall_time() - start_time;
+                close_time += close_timings[i];
+            }
+
+            PASSED();
+
+            HDprintf("    closed %zu files in %.6f s (%.0f files/s)\n", num_files, close_time,
+                     (close_time > 0.0) ? (double)num_files / close_time : 0.0);
+            file_bench_report_latency("H5Fclose", close_timings, num_files);
+        }
+        PART_END(close_many_files);
+    }
+    END_MULTIPART;
+
+    TESTING_2("test cleanup");
+
+    for (i = 0; i < num_files; i++) {
+        char filename[64];
+
+        if (file_ids[i] >= 0 && H5Fclose(file_ids[i]) < 0)
+            TEST_ERROR;
+        file_ids[i] = H5I_INVALID_HID;
+
+        HDsnprintf(filename, sizeof(filename), "%s%zu.h5", FILE_MANY_OPEN_BENCH_FILENAME_PREFIX, i);
+        remove_test_file(test_path_prefix, filename);
+
+        HDfree(filenames[i]);
+        filenames[i] = NULL;
+    }
+
+    HDfree(filenames);
+    filenames = NULL;
+    HDfree(file_ids);
+    file_ids = NULL;
+    HDfree(open_timings);
+    open_timings = NULL;
+    HDfree(close_timings);
+    close_timings = NULL;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (file_ids)
+            for (i = 0; i < num_files; i++)
+                H5Fclose(file_ids[i]);
+    }
+    H5E_END_TRY;
+
+    if (filenames)
+        for (i = 0; i < num_files; i++)
+            HDfree(filenames[i]);
+
+    HDfree(filenames);
+    HDfree(file_ids);
+    HDfree(open_timings);
+    HDfree(close_timings);
+
+    return 1;
+}
+
+/*
+ * Prints the latency percentiles of an operation from
+ * one of the file benchmarks.
+ */
+static void
+file_bench_report_latency(const char *op_name, double *timings, size_t ntimings)
+{
+    sort_timings(timings, ntimings);
+
+    HDprintf("    %s latency (us): p50 %.2f, p99 %.2f, max %.2f\n", op_name,
+             get_timing_percentile(timings, ntimings, 50.0) * 1.0E6,
+             get_timing_percentile(timings, ntimings, 99.0) * 1.0E6,
+             (ntimings > 0) ? timings[ntimings - 1] * 1.0E6 : 0.0);
+}
+
 /*
  * Cleanup temporary test files
  */
@@ -2513,6 +3012,7 @@ cleanup_files(void)
     remove_test_file(test_path_prefix, GET_OBJ_COUNT_TEST_FILENAME2);
     remove_test_file(test_path_prefix, FILE_MOUNT_TEST_FILENAME);
     remove_test_file(test_path_prefix, GET_FILE_NAME_TEST_FNAME);
+    remove_test_file(test_path_prefix, FILE_OPEN_CLOSE_BENCH_FILENAME);
 }
 
 int
@@ -66,6 +66,24 @@ int vol_file_test(void);
 #define GET_FILE_NAME_TEST_ATTR_NAME   "attribute"
 #define GET_FILE_NAME_TEST_NAMED_DTYPE "datatype"
 
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define FILE_OPEN_CLOSE_BENCH_NUM_ITERS    1000
+#define FILE_OPEN_CLOSE_BENCH_GROUP_COUNTS {0, 1000, 10000}
+#else
+#define FILE_OPEN_CLOSE_BENCH_NUM_ITERS    10
+#define FILE_OPEN_CLOSE_BENCH_GROUP_COUNTS {0, 10, 100}
+#endif
+#define FILE_OPEN_CLOSE_BENCH_FILENAME "open_close_bench.h5"
+
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define FILE_MANY_OPEN_BENCH_NUM_FILES 10000
+#else
+#define FILE_MANY_OPEN_BENCH_NUM_FILES 64
+#endif
+#define FILE_MANY_OPEN_BENCH_OBJ_COUNT_ITERS 100
+#define FILE_MANY_OPEN_BENCH_FD_RESERVE      64
+#define FILE_MANY_OPEN_BENCH_FILENAME_PREFIX "many_open_bench"
+
 #define FILESPACE_INFO_FILENAME "filespace_info.h5"
 #define FSP_SIZE512             (hsize_t)512
 
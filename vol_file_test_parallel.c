@@ -15,6 +15,10 @@
 static int test_create_file(void);
 static int test_open_file(void);
 static int test_split_comm_file_access(void);
+static int test_file_scaling_benchmark(void);
+static int test_split_comm_file_access_benchmark(void);
+
+static int split_comm_bench_run(int num_groups, hbool_t shared_file, double *op_times);
 
 /*
  * The array of parallel file tests to be performed.
@@ -23,6 +27,8 @@ static int (*par_file_tests[])(void) = {
     test_create_file,
     test_open_file,
     test_split_comm_file_access,
+    test_file_scaling_benchmark,
+    test_split_comm_file_access_benchmark,
 };
 
 /*
@@ -307,6 +313,541 @@ error:
     return 1;
 }
 
+/*
+ * A benchmark to measure how collective file creation, opening and
+ * closing scale with the number of MPI ranks. Every rank takes part
+ * in each of these operations, so the scaling mode doesn't change
+ * the amount of work done; only the scaling factor is applied to
+ * the number of iterations.
+ */
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define FILE_SCALING_BENCH_BASE_NUM_ITERS 100
+#else
+#define FILE_SCALING_BENCH_BASE_NUM_ITERS 5
+#endif
+#define FILE_SCALING_BENCH_FILENAME "file_scaling_bench.h5"
+static int
+test_file_scaling_benchmark(void)
+{
+    hsize_t num_iters = FILE_SCALING_BENCH_BASE_NUM_ITERS * parallel_scaling_factor_g;
+    hsize_t i;
+    double  start_time;
+    double  create_time = 0.0, open_time = 0.0;
+    hid_t   file_id     = H5I_INVALID_HID;
+    hid_t   fapl_id     = H5I_INVALID_HID;
+
+    TESTING("parallel file create/open/close scaling");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file aren't supported with this connector\n");
+        return 0;
+    }
+
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+        TEST_ERROR;
+
+    for (i = 0; i < num_iters; i++) {
+        if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+            H5_FAILED();
+            HDprintf("    MPI_Barrier failed\n");
+            goto error;
+        }
+
+        start_time = get_wall_time();
+
+        if ((file_id = H5Fcreate(FILE_SCALING_BENCH_FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't create file '%s'\n", FILE_SCALING_BENCH_FILENAME);
+            goto error;
+        }
+
+        if (H5Fclose(file_id) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't close file '%s'\n", FILE_SCALING_BENCH_FILENAME);
+            goto error;
+        }
+        file_id = H5I_INVALID_HID;
+
+        create_time += get_wall_time() - start_time;
+
+        if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+            H5_FAILED();
+            HDprintf("    MPI_Barrier failed\n");
+            goto error;
+        }
+
+        start_time = get_wall_time();
+
+        if ((file_id = H5Fopen(FILE_SCALING_BENCH_FILENAME, H5F_ACC_RDWR, fapl_id)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't open file '%s'\n", FILE_SCALING_BENCH_FILENAME);
+            goto error;
+        }
+
+        if (H5Fclose(file_id) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't close file '%s'\n", FILE_SCALING_BENCH_FILENAME);
+            goto error;
+        }
+        file_id = H5I_INVALID_HID;
+
+        open_time += get_wall_time() - start_time;
+    }
+
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    if (report_parallel_collective_timing("H5Fcreate/H5Fclose", create_time, (double)num_iters, "files") < 0)
+        return 1;
+    if (report_parallel_collective_timing("H5Fopen/H5Fclose", open_time, (double)num_iters, "files") < 0)
+        return 1;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(file_id);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+/*
+ * A benchmark to compare N-to-M and N-to-1 output strategies. The
+ * MPI ranks are split into 1, 2, 4, ..., mpi_size sub-communicators
+ * of consecutive ranks. In the file-per-sub-communicator layout,
+ * each sub-communicator creates, writes and reads back its own file.
+ * In the shared-file layout, all ranks access a single dataset in
+ * a single file, with each sub-communicator owning a contiguous
+ * region of it. In both layouts, each rank writes and then reads
+ * its share of its sub-communicator's data with collective I/O,
+ * and the aggregate bandwidth along with the time spent opening
+ * and closing files is reported.
+ */
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define SPLIT_COMM_BENCH_BASE_NUM_ELEMS 1048576
+#else
+#define SPLIT_COMM_BENCH_BASE_NUM_ELEMS 1024
+#endif
+#define SPLIT_COMM_BENCH_FILE_NAME_PREFIX "split_comm_bench"
+#define SPLIT_COMM_BENCH_SHARED_FILE_NAME "split_comm_bench_shared.h5"
+#define SPLIT_COMM_BENCH_DSET_NAME        "split_comm_dset"
+#define SPLIT_COMM_BENCH_NAME_BUF_SIZE    64
+#define SPLIT_COMM_BENCH_DATA_VALUE(color, index)                                                            \
+    ((int)(((unsigned long long)(color) * 1000 + (index)) % (unsigned long long)INT_MAX))
+
+typedef enum split_comm_bench_op_t {
+    SPLIT_COMM_BENCH_OP_OPEN,
+    SPLIT_COMM_BENCH_OP_WRITE,
+    SPLIT_COMM_BENCH_OP_READ,
+    SPLIT_COMM_BENCH_OP_CLOSE,
+    SPLIT_COMM_BENCH_NUM_OPS
+} split_comm_bench_op_t;
+
+static int
+test_split_comm_file_access_benchmark(void)
+{
+    hsize_t local_nelems;
+    double  op_times[SPLIT_COMM_BENCH_NUM_OPS];
+    double  local_mib, num_files;
+    char    part_name[SPLIT_COMM_BENCH_NAME_BUF_SIZE];
+    int     num_groups;
+    int     err_occurred;
+    int     i;
+
+    TESTING_MULTIPART("split-communicator file access scaling");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file or dataset aren't supported with this connector\n");
+        return 0;
+    }
+
+    get_parallel_scaling_share(SPLIT_COMM_BENCH_BASE_NUM_ELEMS, NULL, &local_nelems, NULL);
+    local_mib = (double)(local_nelems * sizeof(int)) / (1024.0 * 1024.0);
+
+    BEGIN_MULTIPART
+    {
+        for (i = 0; i < 2; i++) {
+            hbool_t shared_file = (i == 1) ? TRUE : FALSE;
+
+            num_groups = 1;
+
+            while (1) {
+                PART_BEGIN(split_comm_configuration)
+                {
+                    HDsnprintf(part_name, SPLIT_COMM_BENCH_NAME_BUF_SIZE, "%d sub-communicator(s), %s",
+                               num_groups, shared_file ? "shared file" : "file per sub-communicator");
+
+                    TESTING_2(part_name);
+
+                    err_occurred = (split_comm_bench_run(num_groups, shared_file, op_times) < 0) ? 1 : 0;
+
+                    /* Get the collective results about whether an error occurred */
+                    if (MPI_SUCCESS != MPI_Allreduce(MPI_IN_PLACE, &err_occurred, 1, MPI_INT, MPI_LOR,
+                                                     MPI_COMM_WORLD)) {
+                        H5_FAILED();
+                        HDprintf("    MPI_Allreduce failed\n");
+                        PART_ERROR(split_comm_configuration);
+                    }
+
+                    if (err_occurred) {
+                        H5_FAILED();
+                        HDprintf("    an error occurred on one or more ranks with %s\n", part_name);
+                        PART_ERROR(split_comm_configuration);
+                    }
+
+                    PASSED();
+
+                    /* Each file is created and then re-opened once */
+                    num_files = 2.0 * (double)(shared_file ? 1 : num_groups);
+
+                    if (report_parallel_scaling_timing("H5Dwrite", op_times[SPLIT_COMM_BENCH_OP_WRITE],
+                                                       local_mib, "MiB") < 0)
+                        PART_ERROR(split_comm_configuration);
+                    if (report_parallel_scaling_timing("H5Dread", op_times[SPLIT_COMM_BENCH_OP_READ],
+                                                       local_mib, "MiB") < 0)
+                        PART_ERROR(split_comm_configuration);
+                    if (report_parallel_collective_timing("H5Fcreate/H5Fopen",
+                                                          op_times[SPLIT_COMM_BENCH_OP_OPEN], num_files,
+                                                          "files") < 0)
+                        PART_ERROR(split_comm_configuration);
+                    if (report_parallel_collective_timing("H5Fclose", op_times[SPLIT_COMM_BENCH_OP_CLOSE],
+                                                          num_files, "files") < 0)
+                        PART_ERROR(split_comm_configuration);
+                }
+                PART_END(split_comm_configuration);
+
+                /* Double the number of sub-communicators, finishing with one per rank */
+                if (num_groups == mpi_size)
+                    break;
+                num_groups = MIN(2 * num_groups, mpi_size);
+            }
+        }
+    }
+    END_MULTIPART;
+
+    return 0;
+
+error:
+    return 1;
+}
+
+/*
+ * Runs one configuration of the split-communicator benchmark,
+ * returning the time this rank spent on each class of operation.
+ * A failure on any rank is agreed on before the next collective
+ * operation, so that all ranks give up together. Must be called
+ * by all MPI ranks.
+ */
+static int
+split_comm_bench_run(int num_groups, hbool_t shared_file, double *op_times)
+{
+    unsigned long long *group_nelems = NULL;
+    unsigned long long  local_offset = 0;
+    unsigned long long  group_offset = 0;
+    unsigned long long  local_size;
+    hsize_t             local_nelems;
+    hsize_t             dims[1], start[1], count[1];
+    MPI_Comm            sub_comm = MPI_COMM_NULL;
+    size_t              j;
+    double              start_time;
+    char                filename[SPLIT_COMM_BENCH_NAME_BUF_SIZE];
+    int                *write_buf = NULL;
+    int                *read_buf  = NULL;
+    int                 color, sub_rank;
+    int                 failed = 0;
+    int                 i;
+    hid_t               file_id   = H5I_INVALID_HID;
+    hid_t               fapl_id   = H5I_INVALID_HID;
+    hid_t               dxpl_id   = H5I_INVALID_HID;
+    hid_t               dset_id   = H5I_INVALID_HID;
+    hid_t               fspace_id = H5I_INVALID_HID;
+    hid_t               mspace_id = H5I_INVALID_HID;
+
+    for (i = 0; i < SPLIT_COMM_BENCH_NUM_OPS; i++)
+        op_times[i] = 0.0;
+
+    /* Assign blocks of consecutive ranks to each sub-communicator */
+    color = (int)(((long long)mpi_rank * num_groups) / mpi_size);
+
+    if (MPI_SUCCESS != MPI_Comm_split(MPI_COMM_WORLD, color, mpi_rank, &sub_comm)) {
+        HDprintf("    failed to split communicator!\n");
+        goto error;
+    }
+
+    if (MPI_SUCCESS != MPI_Comm_rank(sub_comm, &sub_rank))
+        goto error;
+
+    /*
+     * Determine the size of each sub-communicator's dataset and
+     * where this rank's share of it begins.
+     */
+    get_parallel_scaling_share(SPLIT_COMM_BENCH_BASE_NUM_ELEMS, NULL, &local_nelems, NULL);
+    local_size = (unsigned long long)local_nelems;
+
+    if (NULL == (group_nelems = HDcalloc((size_t)num_groups, sizeof(*group_nelems))))
+        failed = 1;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    group_nelems[color] = local_size;
+
+    if (MPI_SUCCESS != MPI_Allreduce(MPI_IN_PLACE, group_nelems, num_groups, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+                                     MPI_COMM_WORLD))
+        goto error;
+
+    if (MPI_SUCCESS != MPI_Exscan(&local_size, &local_offset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, sub_comm))
+        goto error;
+
+    /* The result of MPI_Exscan is undefined on the first rank */
+    if (sub_rank == 0)
+        local_offset = 0;
+
+    /*
+     * In the shared-file layout, the sub-communicators' regions are
+     * laid out one after another in a single dataset, so that all
+     * ranks write and read their shares with one collective call.
+     */
+    if (shared_file) {
+        dims[0] = 0;
+        for (i = 0; i < num_groups; i++) {
+            if (i < color)
+                group_offset += group_nelems[i];
+            dims[0] += (hsize_t)group_nelems[i];
+        }
+    }
+    else
+        dims[0] = (hsize_t)group_nelems[color];
+
+    if (NULL == (write_buf = HDmalloc(local_nelems * sizeof(int))))
+        failed = 1;
+    else if (NULL == (read_buf = HDmalloc(local_nelems * sizeof(int))))
+        failed = 1;
+
+    if (!failed)
+        for (j = 0; j < local_nelems; j++)
+            write_buf[j] = SPLIT_COMM_BENCH_DATA_VALUE(color, local_offset + j);
+
+    if (shared_file)
+        HDsnprintf(filename, SPLIT_COMM_BENCH_NAME_BUF_SIZE, "%s", SPLIT_COMM_BENCH_SHARED_FILE_NAME);
+    else
+        HDsnprintf(filename, SPLIT_COMM_BENCH_NAME_BUF_SIZE, "%s_%d.h5", SPLIT_COMM_BENCH_FILE_NAME_PREFIX,
+                   color);
+
+    if (!failed &&
+        (fapl_id = create_mpi_fapl(shared_file ? MPI_COMM_WORLD : sub_comm, MPI_INFO_NULL, TRUE)) < 0)
+        failed = 1;
+
+    if (!failed && (dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        failed = 1;
+    if (!failed && H5Pset_dxpl_mpio(dxpl_id, H5FD_MPIO_COLLECTIVE) < 0)
+        failed = 1;
+
+    start[0] = (hsize_t)(group_offset + local_offset);
+    count[0] = local_nelems;
+
+    if (!failed && (mspace_id = H5Screate_simple(1, count, NULL)) < 0)
+        failed = 1;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    start_time = get_wall_time();
+
+    if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
+        HDprintf("    couldn't create file '%s'\n", filename);
+        failed = 1;
+    }
+
+    op_times[SPLIT_COMM_BENCH_OP_OPEN] += get_wall_time() - start_time;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    if ((fspace_id = H5Screate_simple(1, dims, NULL)) < 0)
+        failed = 1;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    if ((dset_id = H5Dcreate2(file_id, SPLIT_COMM_BENCH_DSET_NAME, H5T_NATIVE_INT, fspace_id, H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        HDprintf("    couldn't create dataset '%s'\n", SPLIT_COMM_BENCH_DSET_NAME);
+        failed = 1;
+    }
+    else if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        failed = 1;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    start_time = get_wall_time();
+
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, dxpl_id, write_buf) < 0) {
+        HDprintf("    couldn't write to dataset '%s'\n", SPLIT_COMM_BENCH_DSET_NAME);
+        failed = 1;
+    }
+
+    op_times[SPLIT_COMM_BENCH_OP_WRITE] += get_wall_time() - start_time;
+
+    if (H5Sclose(fspace_id) < 0)
+        failed = 1;
+    fspace_id = H5I_INVALID_HID;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    if (H5Dclose(dset_id) < 0)
+        failed = 1;
+    dset_id = H5I_INVALID_HID;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    start_time = get_wall_time();
+
+    if (H5Fclose(file_id) < 0) {
+        HDprintf("    couldn't close file '%s'\n", filename);
+        failed = 1;
+    }
+    file_id = H5I_INVALID_HID;
+
+    op_times[SPLIT_COMM_BENCH_OP_CLOSE] += get_wall_time() - start_time;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    start_time = get_wall_time();
+
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0) {
+        HDprintf("    couldn't open file '%s'\n", filename);
+        failed = 1;
+    }
+
+    op_times[SPLIT_COMM_BENCH_OP_OPEN] += get_wall_time() - start_time;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    if ((dset_id = H5Dopen2(file_id, SPLIT_COMM_BENCH_DSET_NAME, H5P_DEFAULT)) < 0) {
+        HDprintf("    couldn't open dataset '%s'\n", SPLIT_COMM_BENCH_DSET_NAME);
+        failed = 1;
+    }
+    else if ((fspace_id = H5Dget_space(dset_id)) < 0)
+        failed = 1;
+    else if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        failed = 1;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    memset(read_buf, 0, local_nelems * sizeof(int));
+
+    start_time = get_wall_time();
+
+    if (H5Dread(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, dxpl_id, read_buf) < 0) {
+        HDprintf("    couldn't read from dataset '%s'\n", SPLIT_COMM_BENCH_DSET_NAME);
+        failed = 1;
+    }
+
+    op_times[SPLIT_COMM_BENCH_OP_READ] += get_wall_time() - start_time;
+
+    for (j = 0; !failed && j < local_nelems; j++)
+        if (read_buf[j] != write_buf[j]) {
+            HDprintf("    data verification failed for dataset '%s' at index %llu: %d != %d\n",
+                     SPLIT_COMM_BENCH_DSET_NAME, (unsigned long long)start[0] + j, read_buf[j],
+                     write_buf[j]);
+            failed = 1;
+        }
+
+    if (H5Sclose(fspace_id) < 0)
+        failed = 1;
+    fspace_id = H5I_INVALID_HID;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    if (H5Dclose(dset_id) < 0)
+        failed = 1;
+    dset_id = H5I_INVALID_HID;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    start_time = get_wall_time();
+
+    if (H5Fclose(file_id) < 0) {
+        HDprintf("    couldn't close file '%s'\n", filename);
+        failed = 1;
+    }
+    file_id = H5I_INVALID_HID;
+
+    op_times[SPLIT_COMM_BENCH_OP_CLOSE] += get_wall_time() - start_time;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    if (H5Fdelete(filename, fapl_id) < 0) {
+        HDprintf("    couldn't delete file '%s'\n", filename);
+        failed = 1;
+    }
+
+    if (H5Sclose(mspace_id) < 0)
+        failed = 1;
+    mspace_id = H5I_INVALID_HID;
+    if (H5Pclose(dxpl_id) < 0)
+        failed = 1;
+    dxpl_id = H5I_INVALID_HID;
+    if (H5Pclose(fapl_id) < 0)
+        failed = 1;
+    fapl_id = H5I_INVALID_HID;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    HDfree(read_buf);
+    HDfree(write_buf);
+    HDfree(group_nelems);
+
+    if (MPI_SUCCESS != MPI_Comm_free(&sub_comm))
+        return -1;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+        H5Pclose(dxpl_id);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+
+    if (read_buf)
+        HDfree(read_buf);
+    if (write_buf)
+        HDfree(write_buf);
+    if (group_nelems)
+        HDfree(group_nelems);
+    if (sub_comm != MPI_COMM_NULL)
+        MPI_Comm_free(&sub_comm);
+
+    return -1;
+}
+
 /*
  * Cleanup temporary test files
  */
@@ -322,9 +863,11 @@ cleanup_files(void)
     }
 
     H5Fdelete(FILE_CREATE_TEST_FILENAME, fapl_id);
+    H5Fdelete(FILE_SCALING_BENCH_FILENAME, fapl_id);
 
-    /* The below file is deleted as part of the test */
+    /* The below files are deleted as part of the tests */
     /* H5Fdelete(SPLIT_FILE_COMM_TEST_FILE_NAME, H5P_DEFAULT); */
+    /* H5Fdelete(SPLIT_COMM_BENCH_SHARED_FILE_NAME, H5P_DEFAULT); */
 
     if (H5Pclose(fapl_id) < 0) {
         if (MAINPROCESS)
@@ -348,7 +891,7 @@ vol_file_test_parallel(void)
     }
 
     for (i = 0, nerrors = 0; i < ARRAY_LENGTH(par_file_tests); i++) {
-        nerrors += (*par_file_tests[i])() ? 1 : 0;
+        nerrors += run_parallel_test(par_file_tests[i]) ? 1 : 0;
 
         if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
             if (MAINPROCESS)
@@ -12,10 +12,526 @@
 
 #include "vol_group_test_parallel.h"
 
+static int test_create_groups_collective(void);
+static int test_create_groups_rank_private(void);
+static int test_group_scaling_benchmark(void);
+
 /*
  * The array of parallel group tests to be performed.
  */
-static int (*par_group_tests[])(void) = {NULL};
+static int (*par_group_tests[])(void) = {
+    test_create_groups_collective,
+    test_create_groups_rank_private,
+    test_group_scaling_benchmark,
+};
+
+/*
+ * A test to check that many groups can be collectively created
+ * in a single group that is shared by all MPI ranks, reporting
+ * the rate at which the groups were created. The number of
+ * groups depends on the scaling mode that the tests are run with.
+ */
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define GROUP_CREATE_COLL_TEST_BASE_NUM_GROUPS 100
+#else
+#define GROUP_CREATE_COLL_TEST_BASE_NUM_GROUPS 8
+#endif
+#define GROUP_CREATE_COLL_TEST_GROUP_NAME    "collective_group_creation_test"
+#define GROUP_CREATE_COLL_TEST_NAME_BUF_SIZE 64
+static int
+test_create_groups_collective(void)
+{
+    H5G_info_t group_info;
+    hsize_t    global_ngroups, local_ngroups;
+    hsize_t    i;
+    double     start_time, create_time;
+    char       group_name[GROUP_CREATE_COLL_TEST_NAME_BUF_SIZE];
+    hid_t      file_id         = H5I_INVALID_HID;
+    hid_t      fapl_id         = H5I_INVALID_HID;
+    hid_t      container_group = H5I_INVALID_HID;
+    hid_t      parent_group_id = H5I_INVALID_HID;
+    hid_t      group_id        = H5I_INVALID_HID;
+
+    TESTING("collective creation of groups in a shared group");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_MORE) || !(vol_cap_flags_g & H5VL_CAP_FLAG_LINK_BASIC)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file, group, group more, or basic link aren't supported with "
+                 "this connector\n");
+        return 0;
+    }
+
+    get_parallel_scaling_share(GROUP_CREATE_COLL_TEST_BASE_NUM_GROUPS, &global_ngroups, &local_ngroups, NULL);
+
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+        TEST_ERROR;
+
+    if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open file '%s'\n", vol_test_parallel_filename);
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, GROUP_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open container group '%s'\n", GROUP_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((parent_group_id = H5Gcreate2(container_group, GROUP_CREATE_COLL_TEST_GROUP_NAME, H5P_DEFAULT,
+                                      H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create container sub-group '%s'\n", GROUP_CREATE_COLL_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+        H5_FAILED();
+        HDprintf("    MPI_Barrier failed\n");
+        goto error;
+    }
+
+    start_time = get_wall_time();
+
+    for (i = 0; i < global_ngroups; i++) {
+        HDsnprintf(group_name, GROUP_CREATE_COLL_TEST_NAME_BUF_SIZE, "group%llu", (unsigned long long)i);
+
+        if ((group_id = H5Gcreate2(parent_group_id, group_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't create group '%s'\n", group_name);
+            goto error;
+        }
+
+        if (H5Gclose(group_id) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't close group '%s'\n", group_name);
+            goto error;
+        }
+        group_id = H5I_INVALID_HID;
+    }
+
+    create_time = get_wall_time() - start_time;
+
+    /* Verify the final namespace */
+    if (H5Gget_info(parent_group_id, &group_info) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't retrieve group info\n");
+        goto error;
+    }
+
+    if (group_info.nlinks != global_ngroups) {
+        H5_FAILED();
+        HDprintf("    group contained %llu links instead of %llu\n", (unsigned long long)group_info.nlinks,
+                 (unsigned long long)global_ngroups);
+        goto error;
+    }
+
+    for (i = 0; i < global_ngroups; i++) {
+        htri_t group_exists;
+
+        HDsnprintf(group_name, GROUP_CREATE_COLL_TEST_NAME_BUF_SIZE, "group%llu", (unsigned long long)i);
+
+        if ((group_exists = H5Lexists(parent_group_id, group_name, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't determine if group '%s' exists\n", group_name);
+            goto error;
+        }
+
+        if (!group_exists) {
+            H5_FAILED();
+            HDprintf("    group '%s' didn't exist\n", group_name);
+            goto error;
+        }
+    }
+
+    if (H5Gclose(parent_group_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    /*
+     * Every rank takes part in creating each group, so each
+     * rank's share of the groups is counted toward the total.
+     */
+    if (report_parallel_scaling_timing("H5Gcreate2", create_time, (double)local_ngroups, "groups") < 0)
+        return 1;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Gclose(group_id);
+        H5Gclose(parent_group_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+/*
+ * A test to check that groups can be created in a subtree that
+ * belongs to each MPI rank, following the pattern of a checkpoint
+ * library that creates one group per rank per timestep. Since group
+ * creation modifies file metadata, all ranks collectively create the
+ * groups for every rank. Each rank then verifies only its own subtree.
+ */
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define GROUP_CREATE_RANK_PRIVATE_TEST_BASE_NUM_STEPS 100
+#else
+#define GROUP_CREATE_RANK_PRIVATE_TEST_BASE_NUM_STEPS 4
+#endif
+#define GROUP_CREATE_RANK_PRIVATE_TEST_GROUP_NAME    "rank_private_group_creation_test"
+#define GROUP_CREATE_RANK_PRIVATE_TEST_NAME_BUF_SIZE 64
+static int
+test_create_groups_rank_private(void)
+{
+    H5G_info_t group_info;
+    hsize_t    num_steps = GROUP_CREATE_RANK_PRIVATE_TEST_BASE_NUM_STEPS * parallel_scaling_factor_g;
+    hsize_t    i;
+    double     start_time, create_time;
+    char       group_name[GROUP_CREATE_RANK_PRIVATE_TEST_NAME_BUF_SIZE];
+    hid_t      file_id         = H5I_INVALID_HID;
+    hid_t      fapl_id         = H5I_INVALID_HID;
+    hid_t      container_group = H5I_INVALID_HID;
+    hid_t      parent_group_id = H5I_INVALID_HID;
+    hid_t      rank_group_id   = H5I_INVALID_HID;
+    hid_t      group_id        = H5I_INVALID_HID;
+    int        rank;
+
+    TESTING("creation of groups in rank-private subtrees");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_MORE) || !(vol_cap_flags_g & H5VL_CAP_FLAG_LINK_BASIC)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file, group, group more, or basic link aren't supported with "
+                 "this connector\n");
+        return 0;
+    }
+
+    /*
+     * Use independent metadata reads so that each
+     * rank can verify its own subtree on its own.
+     */
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, FALSE)) < 0)
+        TEST_ERROR;
+
+    if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open file '%s'\n", vol_test_parallel_filename);
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, GROUP_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open container group '%s'\n", GROUP_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((parent_group_id = H5Gcreate2(container_group, GROUP_CREATE_RANK_PRIVATE_TEST_GROUP_NAME,
+                                      H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create container sub-group '%s'\n", GROUP_CREATE_RANK_PRIVATE_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    for (rank = 0; rank < mpi_size; rank++) {
+        HDsnprintf(group_name, GROUP_CREATE_RANK_PRIVATE_TEST_NAME_BUF_SIZE, "rank%d", rank);
+
+        if ((group_id = H5Gcreate2(parent_group_id, group_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't create subtree group '%s'\n", group_name);
+            goto error;
+        }
+
+        if (H5Gclose(group_id) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't close subtree group '%s'\n", group_name);
+            goto error;
+        }
+        group_id = H5I_INVALID_HID;
+    }
+
+    if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+        H5_FAILED();
+        HDprintf("    MPI_Barrier failed\n");
+        goto error;
+    }
+
+    start_time = get_wall_time();
+
+    for (i = 0; i < num_steps; i++) {
+        for (rank = 0; rank < mpi_size; rank++) {
+            HDsnprintf(group_name, GROUP_CREATE_RANK_PRIVATE_TEST_NAME_BUF_SIZE, "rank%d/step%llu", rank,
+                       (unsigned long long)i);
+
+            if ((group_id = H5Gcreate2(parent_group_id, group_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+                0) {
+                H5_FAILED();
+                HDprintf("    couldn't create group '%s'\n", group_name);
+                goto error;
+            }
+
+            if (H5Gclose(group_id) < 0) {
+                H5_FAILED();
+                HDprintf("    couldn't close group '%s'\n", group_name);
+                goto error;
+            }
+            group_id = H5I_INVALID_HID;
+        }
+    }
+
+    create_time = get_wall_time() - start_time;
+
+    /* Verify this rank's subtree */
+    HDsnprintf(group_name, GROUP_CREATE_RANK_PRIVATE_TEST_NAME_BUF_SIZE, "rank%d", mpi_rank);
+
+    BEGIN_INDEPENDENT_OP(verify_rank_subtree)
+    {
+        if ((rank_group_id = H5Gopen2(parent_group_id, group_name, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't open subtree group '%s' on rank %d\n", group_name, mpi_rank);
+            INDEPENDENT_OP_ERROR(verify_rank_subtree);
+        }
+
+        if (H5Gget_info(rank_group_id, &group_info) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't retrieve info for subtree group '%s' on rank %d\n", group_name, mpi_rank);
+            INDEPENDENT_OP_ERROR(verify_rank_subtree);
+        }
+
+        if (group_info.nlinks != num_steps) {
+            H5_FAILED();
+            HDprintf("    subtree group '%s' contained %llu links instead of %llu\n", group_name,
+                     (unsigned long long)group_info.nlinks, (unsigned long long)num_steps);
+            INDEPENDENT_OP_ERROR(verify_rank_subtree);
+        }
+
+        for (i = 0; i < num_steps; i++) {
+            htri_t group_exists;
+
+            HDsnprintf(group_name, GROUP_CREATE_RANK_PRIVATE_TEST_NAME_BUF_SIZE, "step%llu",
+                       (unsigned long long)i);
+
+            if ((group_exists = H5Lexists(rank_group_id, group_name, H5P_DEFAULT)) <= 0) {
+                H5_FAILED();
+                HDprintf("    group '%s' didn't exist in subtree of rank %d\n", group_name, mpi_rank);
+                INDEPENDENT_OP_ERROR(verify_rank_subtree);
+            }
+        }
+    }
+    END_INDEPENDENT_OP(verify_rank_subtree);
+
+    if (H5Gclose(rank_group_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(parent_group_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    /*
+     * Each rank is credited with the groups in its own subtree,
+     * even though every rank takes part in creating all of them.
+     */
+    if (report_parallel_scaling_timing("H5Gcreate2", create_time, (double)num_steps, "groups") < 0)
+        return 1;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Gclose(group_id);
+        H5Gclose(rank_group_id);
+        H5Gclose(parent_group_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+/*
+ * A benchmark to measure how group creation and access scale with
+ * the number of MPI ranks. Since creating a group modifies file
+ * metadata, all ranks collectively create every group. Each rank
+ * then independently opens and queries only its own share of the
+ * groups, where the number of groups depends on the scaling mode
+ * that the tests are run with.
+ */
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define GROUP_SCALING_BENCH_BASE_NUM_GROUPS 1000
+#else
+#define GROUP_SCALING_BENCH_BASE_NUM_GROUPS 16
+#endif
+#define GROUP_SCALING_BENCH_FILE_NAME         "group_scaling_bench.h5"
+#define GROUP_SCALING_BENCH_GROUP_NAME_PREFIX "group_scaling_bench_group"
+#define GROUP_SCALING_BENCH_GROUP_NAME_LEN    64
+static int
+test_group_scaling_benchmark(void)
+{
+    H5G_info_t group_info;
+    hsize_t    global_ngroups, local_ngroups, local_offset;
+    hsize_t    i;
+    double     start_time;
+    double     create_time, open_time;
+    char       group_name[GROUP_SCALING_BENCH_GROUP_NAME_LEN];
+    hid_t      file_id  = H5I_INVALID_HID;
+    hid_t      fapl_id  = H5I_INVALID_HID;
+    hid_t      group_id = H5I_INVALID_HID;
+
+    TESTING("parallel group creation and access scaling");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_MORE)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file, group, or group more aren't supported with this "
+                 "connector\n");
+        return 0;
+    }
+
+    get_parallel_scaling_share(GROUP_SCALING_BENCH_BASE_NUM_GROUPS, &global_ngroups, &local_ngroups,
+                               &local_offset);
+
+    /*
+     * Use independent metadata reads so that each
+     * rank can open its groups on its own.
+     */
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, FALSE)) < 0)
+        TEST_ERROR;
+
+    if ((file_id = H5Fcreate(GROUP_SCALING_BENCH_FILE_NAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create file '%s'\n", GROUP_SCALING_BENCH_FILE_NAME);
+        goto error;
+    }
+
+    if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+        H5_FAILED();
+        HDprintf("    MPI_Barrier failed\n");
+        goto error;
+    }
+
+    start_time = get_wall_time();
+
+    for (i = 0; i < global_ngroups; i++) {
+        HDsnprintf(group_name, GROUP_SCALING_BENCH_GROUP_NAME_LEN, "%s%llu",
+                   GROUP_SCALING_BENCH_GROUP_NAME_PREFIX, (unsigned long long)i);
+
+        if ((group_id = H5Gcreate2(file_id, group_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't create group '%s'\n", group_name);
+            goto error;
+        }
+
+        if (H5Gclose(group_id) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't close group '%s'\n", group_name);
+            goto error;
+        }
+        group_id = H5I_INVALID_HID;
+    }
+
+    create_time = get_wall_time() - start_time;
+
+    if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+        H5_FAILED();
+        HDprintf("    MPI_Barrier failed\n");
+        goto error;
+    }
+
+    start_time = get_wall_time();
+
+    for (i = local_offset; i < local_offset + local_ngroups; i++) {
+        HDsnprintf(group_name, GROUP_SCALING_BENCH_GROUP_NAME_LEN, "%s%llu",
+                   GROUP_SCALING_BENCH_GROUP_NAME_PREFIX, (unsigned long long)i);
+
+        if ((group_id = H5Gopen2(file_id, group_name, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't open group '%s'\n", group_name);
+            goto error;
+        }
+
+        if (H5Gget_info(group_id, &group_info) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't retrieve info for group '%s'\n", group_name);
+            goto error;
+        }
+
+        if (group_info.nlinks != 0) {
+            H5_FAILED();
+            HDprintf("    group '%s' had %llu links instead of 0\n", group_name,
+                     (unsigned long long)group_info.nlinks);
+            goto error;
+        }
+
+        if (H5Gclose(group_id) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't close group '%s'\n", group_name);
+            goto error;
+        }
+        group_id = H5I_INVALID_HID;
+    }
+
+    open_time = get_wall_time() - start_time;
+
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+
+    if (H5Fdelete(GROUP_SCALING_BENCH_FILE_NAME, fapl_id) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't delete file '%s'\n", GROUP_SCALING_BENCH_FILE_NAME);
+        goto error;
+    }
+
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    /*
+     * Every rank takes part in creating each group, so each
+     * rank's share of the groups is counted toward the total.
+     */
+    if (report_parallel_scaling_timing("H5Gcreate2", create_time, (double)local_ngroups, "groups") < 0)
+        return 1;
+    if (report_parallel_scaling_timing("H5Gopen2", open_time, (double)local_ngroups, "groups") < 0)
+        return 1;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Gclose(group_id);
+        H5Fclose(file_id);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
 
 int
 vol_group_test_parallel(void)
@@ -32,7 +548,7 @@ vol_group_test_parallel(void)
     }
 
     for (i = 0, nerrors = 0; i < ARRAY_LENGTH(par_group_tests); i++) {
-        /* nerrors += (*par_group_tests[i])() ? 1 : 0; */
+        nerrors += run_parallel_test(par_group_tests[i]) ? 1 : 0;
 
         if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
             if (MAINPROCESS)
@@ -12,10 +12,501 @@
 
 #include "vol_link_test_parallel.h"
 
+static int test_create_links_collective(void);
+static int test_create_links_rank_private(void);
+
 /*
  * The array of parallel link tests to be performed.
  */
-static int (*par_link_tests[])(void) = {NULL};
+static int (*par_link_tests[])(void) = {
+    test_create_links_collective,
+    test_create_links_rank_private,
+};
+
+/*
+ * A test to check that many hard and soft links can be collectively
+ * created in a single group that is shared by all MPI ranks, reporting
+ * the rate at which the links were created. The number of links
+ * depends on the scaling mode that the tests are run with.
+ */
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define LINK_CREATE_COLL_TEST_BASE_NUM_LINKS 100
+#else
+#define LINK_CREATE_COLL_TEST_BASE_NUM_LINKS 8
+#endif
+#define LINK_CREATE_COLL_TEST_GROUP_NAME    "collective_link_creation_test"
+#define LINK_CREATE_COLL_TEST_TARGET_NAME   "link_target"
+#define LINK_CREATE_COLL_TEST_NAME_BUF_SIZE 64
+static int
+test_create_links_collective(void)
+{
+    H5O_info2_t object_info;
+    H5L_info2_t link_info;
+    hsize_t     global_nlinks, local_nlinks;
+    hsize_t     i;
+    double      start_time, create_time;
+    char        link_name[LINK_CREATE_COLL_TEST_NAME_BUF_SIZE];
+    hid_t       file_id         = H5I_INVALID_HID;
+    hid_t       fapl_id         = H5I_INVALID_HID;
+    hid_t       container_group = H5I_INVALID_HID;
+    hid_t       group_id        = H5I_INVALID_HID;
+    hid_t       target_id       = H5I_INVALID_HID;
+    hid_t       obj_id          = H5I_INVALID_HID;
+
+    TESTING_MULTIPART("collective creation of links in a shared group");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_LINK_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_LINK_MORE) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_OBJECT_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_OBJECT_MORE) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_HARD_LINKS) || !(vol_cap_flags_g & H5VL_CAP_FLAG_SOFT_LINKS)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file, group, link, hard link, soft link, or object aren't "
+                 "supported with this connector\n");
+        return 0;
+    }
+
+    TESTING_2("test setup");
+
+    get_parallel_scaling_share(LINK_CREATE_COLL_TEST_BASE_NUM_LINKS, &global_nlinks, &local_nlinks, NULL);
+
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+        TEST_ERROR;
+
+    if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open file '%s'\n", vol_test_parallel_filename);
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open container group '%s'\n", LINK_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((group_id = H5Gcreate2(container_group, LINK_CREATE_COLL_TEST_GROUP_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                               H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create container sub-group '%s'\n", LINK_CREATE_COLL_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((target_id = H5Gcreate2(group_id, LINK_CREATE_COLL_TEST_TARGET_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                                H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create link target group '%s'\n", LINK_CREATE_COLL_TEST_TARGET_NAME);
+        goto error;
+    }
+
+    PASSED();
+
+    BEGIN_MULTIPART
+    {
+        PART_BEGIN(H5Lcreate_hard_collective)
+        {
+            TESTING_2("H5Lcreate_hard by all ranks");
+
+            if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+                H5_FAILED();
+                HDprintf("    MPI_Barrier failed\n");
+                PART_ERROR(H5Lcreate_hard_collective);
+            }
+
+            start_time = get_wall_time();
+
+            for (i = 0; i < global_nlinks; i++) {
+                HDsnprintf(link_name, LINK_CREATE_COLL_TEST_NAME_BUF_SIZE, "hard_link%llu",
+                           (unsigned long long)i);
+
+                if (H5Lcreate_hard(group_id, LINK_CREATE_COLL_TEST_TARGET_NAME, group_id, link_name,
+                                   H5P_DEFAULT, H5P_DEFAULT) < 0) {
+                    H5_FAILED();
+                    HDprintf("    couldn't create hard link '%s'\n", link_name);
+                    PART_ERROR(H5Lcreate_hard_collective);
+                }
+            }
+
+            create_time = get_wall_time() - start_time;
+
+            /* Verify the final namespace */
+            for (i = 0; i < global_nlinks; i++) {
+                HDsnprintf(link_name, LINK_CREATE_COLL_TEST_NAME_BUF_SIZE, "hard_link%llu",
+                           (unsigned long long)i);
+
+                if (H5Lget_info2(group_id, link_name, &link_info, H5P_DEFAULT) < 0) {
+                    H5_FAILED();
+                    HDprintf("    couldn't retrieve info for link '%s'\n", link_name);
+                    PART_ERROR(H5Lcreate_hard_collective);
+                }
+
+                if (link_info.type != H5L_TYPE_HARD) {
+                    H5_FAILED();
+                    HDprintf("    link '%s' wasn't a hard link\n", link_name);
+                    PART_ERROR(H5Lcreate_hard_collective);
+                }
+            }
+
+            if (H5Oget_info3(target_id, &object_info, H5O_INFO_BASIC) < 0) {
+                H5_FAILED();
+                HDprintf("    couldn't retrieve info for link target group\n");
+                PART_ERROR(H5Lcreate_hard_collective);
+            }
+
+            if (object_info.rc != global_nlinks + 1) {
+                H5_FAILED();
+                HDprintf("    link target group's reference count was %u instead of %llu\n", object_info.rc,
+                         (unsigned long long)(global_nlinks + 1));
+                PART_ERROR(H5Lcreate_hard_collective);
+            }
+
+            PASSED();
+
+            if (report_parallel_scaling_timing("H5Lcreate_hard", create_time, (double)local_nlinks,
+                                               "links") < 0)
+                PART_ERROR(H5Lcreate_hard_collective);
+        }
+        PART_END(H5Lcreate_hard_collective);
+
+        PART_BEGIN(H5Lcreate_soft_collective)
+        {
+            TESTING_2("H5Lcreate_soft by all ranks");
+
+            if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+                H5_FAILED();
+                HDprintf("    MPI_Barrier failed\n");
+                PART_ERROR(H5Lcreate_soft_collective);
+            }
+
+            start_time = get_wall_time();
+
+            for (i = 0; i < global_nlinks; i++) {
+                HDsnprintf(link_name, LINK_CREATE_COLL_TEST_NAME_BUF_SIZE, "soft_link%llu",
+                           (unsigned long long)i);
+
+                if (H5Lcreate_soft(LINK_CREATE_COLL_TEST_TARGET_NAME, group_id, link_name, H5P_DEFAULT,
+                                   H5P_DEFAULT) < 0) {
+                    H5_FAILED();
+                    HDprintf("    couldn't create soft link '%s'\n", link_name);
+                    PART_ERROR(H5Lcreate_soft_collective);
+                }
+            }
+
+            create_time = get_wall_time() - start_time;
+
+            /* Verify the final namespace */
+            for (i = 0; i < global_nlinks; i++) {
+                HDsnprintf(link_name, LINK_CREATE_COLL_TEST_NAME_BUF_SIZE, "soft_link%llu",
+                           (unsigned long long)i);
+
+                if (H5Lget_info2(group_id, link_name, &link_info, H5P_DEFAULT) < 0) {
+                    H5_FAILED();
+                    HDprintf("    couldn't retrieve info for link '%s'\n", link_name);
+                    PART_ERROR(H5Lcreate_soft_collective);
+                }
+
+                if (link_info.type != H5L_TYPE_SOFT) {
+                    H5_FAILED();
+                    HDprintf("    link '%s' wasn't a soft link\n", link_name);
+                    PART_ERROR(H5Lcreate_soft_collective);
+                }
+
+                if ((obj_id = H5Oopen(group_id, link_name, H5P_DEFAULT)) < 0) {
+                    H5_FAILED();
+                    HDprintf("    couldn't open link target through soft link '%s'\n", link_name);
+                    PART_ERROR(H5Lcreate_soft_collective);
+                }
+
+                if (H5Oclose(obj_id) < 0) {
+                    H5_FAILED();
+                    HDprintf("    couldn't close link target opened through soft link '%s'\n", link_name);
+                    PART_ERROR(H5Lcreate_soft_collective);
+                }
+                obj_id = H5I_INVALID_HID;
+            }
+
+            PASSED();
+
+            if (report_parallel_scaling_timing("H5Lcreate_soft", create_time, (double)local_nlinks,
+                                               "links") < 0)
+                PART_ERROR(H5Lcreate_soft_collective);
+        }
+        PART_END(H5Lcreate_soft_collective);
+
+        if (obj_id >= 0) {
+            H5E_BEGIN_TRY
+            {
+                H5Oclose(obj_id);
+            }
+            H5E_END_TRY;
+            obj_id = H5I_INVALID_HID;
+        }
+    }
+    END_MULTIPART;
+
+    TESTING_2("test cleanup");
+
+    if (H5Gclose(target_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Oclose(obj_id);
+        H5Gclose(target_id);
+        H5Gclose(group_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+/*
+ * A test to check that hard and soft links can be created in a
+ * subtree that belongs to each MPI rank. Since link creation
+ * modifies file metadata, all ranks collectively create the links
+ * for every rank. Each rank then verifies only its own subtree.
+ */
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define LINK_CREATE_RANK_PRIVATE_TEST_BASE_NUM_LINKS 100
+#else
+#define LINK_CREATE_RANK_PRIVATE_TEST_BASE_NUM_LINKS 4
+#endif
+#define LINK_CREATE_RANK_PRIVATE_TEST_GROUP_NAME    "rank_private_link_creation_test"
+#define LINK_CREATE_RANK_PRIVATE_TEST_TARGET_NAME   "link_target"
+#define LINK_CREATE_RANK_PRIVATE_TEST_NAME_BUF_SIZE 64
+static int
+test_create_links_rank_private(void)
+{
+    H5G_info_t  group_info;
+    H5L_info2_t link_info;
+    hsize_t     num_links = LINK_CREATE_RANK_PRIVATE_TEST_BASE_NUM_LINKS * parallel_scaling_factor_g;
+    hsize_t     i;
+    double      start_time, create_time;
+    char        link_name[LINK_CREATE_RANK_PRIVATE_TEST_NAME_BUF_SIZE];
+    char        subtree_name[LINK_CREATE_RANK_PRIVATE_TEST_NAME_BUF_SIZE];
+    hid_t       file_id         = H5I_INVALID_HID;
+    hid_t       fapl_id         = H5I_INVALID_HID;
+    hid_t       container_group = H5I_INVALID_HID;
+    hid_t       group_id        = H5I_INVALID_HID;
+    hid_t       subtree_id      = H5I_INVALID_HID;
+    hid_t       target_id       = H5I_INVALID_HID;
+    int         rank;
+
+    TESTING("creation of links in rank-private subtrees");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_MORE) || !(vol_cap_flags_g & H5VL_CAP_FLAG_LINK_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_LINK_MORE) || !(vol_cap_flags_g & H5VL_CAP_FLAG_HARD_LINKS) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_SOFT_LINKS)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file, group, link, hard link, or soft link aren't supported "
+                 "with this connector\n");
+        return 0;
+    }
+
+    /*
+     * Use independent metadata reads so that each
+     * rank can verify its own subtree on its own.
+     */
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, FALSE)) < 0)
+        TEST_ERROR;
+
+    if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open file '%s'\n", vol_test_parallel_filename);
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, LINK_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open container group '%s'\n", LINK_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((group_id = H5Gcreate2(container_group, LINK_CREATE_RANK_PRIVATE_TEST_GROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create container sub-group '%s'\n", LINK_CREATE_RANK_PRIVATE_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    for (rank = 0; rank < mpi_size; rank++) {
+        HDsnprintf(subtree_name, LINK_CREATE_RANK_PRIVATE_TEST_NAME_BUF_SIZE, "rank%d", rank);
+
+        if ((subtree_id = H5Gcreate2(group_id, subtree_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't create subtree group '%s'\n", subtree_name);
+            goto error;
+        }
+
+        if ((target_id = H5Gcreate2(subtree_id, LINK_CREATE_RANK_PRIVATE_TEST_TARGET_NAME, H5P_DEFAULT,
+                                    H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't create link target group in subtree '%s'\n", subtree_name);
+            goto error;
+        }
+
+        if (H5Gclose(target_id) < 0)
+            TEST_ERROR;
+        target_id = H5I_INVALID_HID;
+        if (H5Gclose(subtree_id) < 0)
+            TEST_ERROR;
+        subtree_id = H5I_INVALID_HID;
+    }
+
+    if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+        H5_FAILED();
+        HDprintf("    MPI_Barrier failed\n");
+        goto error;
+    }
+
+    start_time = get_wall_time();
+
+    for (rank = 0; rank < mpi_size; rank++) {
+        HDsnprintf(subtree_name, LINK_CREATE_RANK_PRIVATE_TEST_NAME_BUF_SIZE, "rank%d", rank);
+
+        if ((subtree_id = H5Gopen2(group_id, subtree_name, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't open subtree group '%s'\n", subtree_name);
+            goto error;
+        }
+
+        for (i = 0; i < num_links; i++) {
+            HDsnprintf(link_name, LINK_CREATE_RANK_PRIVATE_TEST_NAME_BUF_SIZE, "hard_link%llu",
+                       (unsigned long long)i);
+
+            if (H5Lcreate_hard(subtree_id, LINK_CREATE_RANK_PRIVATE_TEST_TARGET_NAME, subtree_id, link_name,
+                               H5P_DEFAULT, H5P_DEFAULT) < 0) {
+                H5_FAILED();
+                HDprintf("    couldn't create hard link '%s' in subtree '%s'\n", link_name, subtree_name);
+                goto error;
+            }
+
+            HDsnprintf(link_name, LINK_CREATE_RANK_PRIVATE_TEST_NAME_BUF_SIZE, "soft_link%llu",
+                       (unsigned long long)i);
+
+            if (H5Lcreate_soft(LINK_CREATE_RANK_PRIVATE_TEST_TARGET_NAME, subtree_id, link_name, H5P_DEFAULT,
+                               H5P_DEFAULT) < 0) {
+                H5_FAILED();
+                HDprintf("    couldn't create soft link '%s' in subtree '%s'\n", link_name, subtree_name);
+                goto error;
+            }
+        }
+
+        if (H5Gclose(subtree_id) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't close subtree group '%s'\n", subtree_name);
+            goto error;
+        }
+        subtree_id = H5I_INVALID_HID;
+    }
+
+    create_time = get_wall_time() - start_time;
+
+    /* Verify this rank's subtree */
+    HDsnprintf(subtree_name, LINK_CREATE_RANK_PRIVATE_TEST_NAME_BUF_SIZE, "rank%d", mpi_rank);
+
+    BEGIN_INDEPENDENT_OP(verify_rank_subtree)
+    {
+        if ((subtree_id = H5Gopen2(group_id, subtree_name, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't open subtree group '%s' on rank %d\n", subtree_name, mpi_rank);
+            INDEPENDENT_OP_ERROR(verify_rank_subtree);
+        }
+
+        if (H5Gget_info(subtree_id, &group_info) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't retrieve info for subtree group '%s' on rank %d\n", subtree_name,
+                     mpi_rank);
+            INDEPENDENT_OP_ERROR(verify_rank_subtree);
+        }
+
+        /* The link target, plus a hard and soft link for each iteration */
+        if (group_info.nlinks != (2 * num_links) + 1) {
+            H5_FAILED();
+            HDprintf("    subtree group '%s' contained %llu links instead of %llu\n", subtree_name,
+                     (unsigned long long)group_info.nlinks, (unsigned long long)((2 * num_links) + 1));
+            INDEPENDENT_OP_ERROR(verify_rank_subtree);
+        }
+
+        for (i = 0; i < num_links; i++) {
+            HDsnprintf(link_name, LINK_CREATE_RANK_PRIVATE_TEST_NAME_BUF_SIZE, "hard_link%llu",
+                       (unsigned long long)i);
+
+            if (H5Lget_info2(subtree_id, link_name, &link_info, H5P_DEFAULT) < 0 ||
+                link_info.type != H5L_TYPE_HARD) {
+                H5_FAILED();
+                HDprintf("    link '%s' in subtree '%s' wasn't a hard link\n", link_name, subtree_name);
+                INDEPENDENT_OP_ERROR(verify_rank_subtree);
+            }
+
+            HDsnprintf(link_name, LINK_CREATE_RANK_PRIVATE_TEST_NAME_BUF_SIZE, "soft_link%llu",
+                       (unsigned long long)i);
+
+            if (H5Lget_info2(subtree_id, link_name, &link_info, H5P_DEFAULT) < 0 ||
+                link_info.type != H5L_TYPE_SOFT) {
+                H5_FAILED();
+                HDprintf("    link '%s' in subtree '%s' wasn't a soft link\n", link_name, subtree_name);
+                INDEPENDENT_OP_ERROR(verify_rank_subtree);
+            }
+        }
+    }
+    END_INDEPENDENT_OP(verify_rank_subtree);
+
+    if (H5Gclose(subtree_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    /*
+     * Each rank is credited with the links in its own subtree,
+     * even though every rank takes part in creating all of them.
+     */
+    if (report_parallel_scaling_timing("H5Lcreate_hard/H5Lcreate_soft", create_time, (double)(2 * num_links),
+                                       "links") < 0)
+        return 1;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Gclose(target_id);
+        H5Gclose(subtree_id);
+        H5Gclose(group_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
 
 int
 vol_link_test_parallel(void)
@@ -32,7 +523,7 @@ vol_link_test_parallel(void)
     }
 
     for (i = 0, nerrors = 0; i < ARRAY_LENGTH(par_link_tests); i++) {
-        /* nerrors += (*par_link_tests[i])() ? 1 : 0; */
+        nerrors += run_parallel_test(par_link_tests[i]) ? 1 : 0;
 
         if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
             if (MAINPROCESS)
@@ -32,7 +32,7 @@ vol_misc_test_parallel(void)
     }
 
     for (i = 0, nerrors = 0; i < ARRAY_LENGTH(par_misc_tests); i++) {
-        /* nerrors += (*par_misc_tests[i])() ? 1 : 0; */
+        /* nerrors += run_parallel_test(par_misc_tests[i]) ? 1 : 0; */
 
         if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
             if (MAINPROCESS)
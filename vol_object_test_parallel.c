@@ -12,10 +12,981 @@
 
 #include "vol_object_test_parallel.h"
 
+static int test_object_copy_collective(void);
+static int test_object_visit_all_ranks(void);
+static int test_collective_metadata_benchmark(void);
+
+static herr_t object_visit_all_ranks_cb(hid_t o_id, const char *name, const H5O_info2_t *object_info,
+                                        void *op_data);
+static int    object_coll_md_bench_run(hbool_t coll_md_read, hbool_t coll_md_write, double *op_times);
+static herr_t object_coll_md_bench_link_iter_cb(hid_t group_id, const char *name, const H5L_info2_t *info,
+                                                void *op_data);
+static int    object_coll_md_bench_report(const char *op_name, double local_time, size_t num_ops);
+
 /*
  * The array of parallel object tests to be performed.
  */
-static int (*par_object_tests[])(void) = {NULL};
+static int (*par_object_tests[])(void) = {
+    test_object_copy_collective,
+    test_object_visit_all_ranks,
+    test_collective_metadata_benchmark,
+};
+
+/*
+ * A test to check that a group containing sub-groups, a committed
+ * datatype and a dataset written to by all MPI ranks can be copied
+ * collectively with H5Ocopy. Each rank then checks that its portion
+ * of the dataset data was copied correctly.
+ */
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define OBJECT_COPY_COLLECTIVE_TEST_NUM_SUBGROUPS 100
+#define OBJECT_COPY_COLLECTIVE_TEST_NUM_COPIES    10
+#define OBJECT_COPY_COLLECTIVE_TEST_DSET_DIM      65536
+#else
+#define OBJECT_COPY_COLLECTIVE_TEST_NUM_SUBGROUPS 8
+#define OBJECT_COPY_COLLECTIVE_TEST_NUM_COPIES    2
+#define OBJECT_COPY_COLLECTIVE_TEST_DSET_DIM      64
+#endif
+#define OBJECT_COPY_COLLECTIVE_TEST_GROUP_NAME    "collective_object_copy_test"
+#define OBJECT_COPY_COLLECTIVE_TEST_SRC_NAME      "copy_source"
+#define OBJECT_COPY_COLLECTIVE_TEST_DSET_NAME     "copy_dset"
+#define OBJECT_COPY_COLLECTIVE_TEST_DTYPE_NAME    "copy_dtype"
+#define OBJECT_COPY_COLLECTIVE_TEST_NAME_BUF_SIZE 64
+static int
+test_object_copy_collective(void)
+{
+    H5G_info_t group_info;
+    hsize_t    dims[2];
+    hsize_t    start[2], count[2];
+    size_t     i, j;
+    double     start_time, copy_time;
+    char       object_name[OBJECT_COPY_COLLECTIVE_TEST_NAME_BUF_SIZE];
+    int       *write_buf       = NULL;
+    int       *read_buf        = NULL;
+    hid_t      file_id         = H5I_INVALID_HID;
+    hid_t      fapl_id         = H5I_INVALID_HID;
+    hid_t      container_group = H5I_INVALID_HID;
+    hid_t      group_id        = H5I_INVALID_HID;
+    hid_t      src_group_id    = H5I_INVALID_HID;
+    hid_t      subgroup_id     = H5I_INVALID_HID;
+    hid_t      copy_group_id   = H5I_INVALID_HID;
+    hid_t      dset_id         = H5I_INVALID_HID;
+    hid_t      type_id         = H5I_INVALID_HID;
+    hid_t      dset_type_id    = H5I_INVALID_HID;
+    hid_t      fspace_id       = H5I_INVALID_HID;
+    hid_t      mspace_id       = H5I_INVALID_HID;
+
+    TESTING("collective object copy");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_DATASET_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_OBJECT_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_OBJECT_MORE) || !(vol_cap_flags_g & H5VL_CAP_FLAG_LINK_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_STORED_DATATYPES)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file, group, dataset, object, link, stored datatype, or more "
+                 "object aren't supported with this connector\n");
+        return 0;
+    }
+
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+        TEST_ERROR;
+
+    if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open file '%s'\n", vol_test_parallel_filename);
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, OBJECT_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open container group '%s'\n", OBJECT_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((group_id = H5Gcreate2(container_group, OBJECT_COPY_COLLECTIVE_TEST_GROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create container sub-group '%s'\n", OBJECT_COPY_COLLECTIVE_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((src_group_id = H5Gcreate2(group_id, OBJECT_COPY_COLLECTIVE_TEST_SRC_NAME, H5P_DEFAULT, H5P_DEFAULT,
+                                   H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create source group '%s'\n", OBJECT_COPY_COLLECTIVE_TEST_SRC_NAME);
+        goto error;
+    }
+
+    for (i = 0; i < OBJECT_COPY_COLLECTIVE_TEST_NUM_SUBGROUPS; i++) {
+        HDsnprintf(object_name, OBJECT_COPY_COLLECTIVE_TEST_NAME_BUF_SIZE, "subgroup%zu", i);
+
+        if ((subgroup_id =
+                 H5Gcreate2(src_group_id, object_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't create sub-group '%s'\n", object_name);
+            goto error;
+        }
+
+        if (H5Gclose(subgroup_id) < 0)
+            TEST_ERROR;
+        subgroup_id = H5I_INVALID_HID;
+    }
+
+    if ((type_id = H5Tcopy(H5T_NATIVE_INT)) < 0)
+        TEST_ERROR;
+
+    if (H5Tcommit2(src_group_id, OBJECT_COPY_COLLECTIVE_TEST_DTYPE_NAME, type_id, H5P_DEFAULT, H5P_DEFAULT,
+                   H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't commit datatype '%s'\n", OBJECT_COPY_COLLECTIVE_TEST_DTYPE_NAME);
+        goto error;
+    }
+
+    /* Each rank writes one row of the dataset, which uses the committed datatype */
+    dims[0] = (hsize_t)mpi_size;
+    dims[1] = OBJECT_COPY_COLLECTIVE_TEST_DSET_DIM;
+
+    if ((fspace_id = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+
+    if ((dset_id = H5Dcreate2(src_group_id, OBJECT_COPY_COLLECTIVE_TEST_DSET_NAME, type_id, fspace_id,
+                              H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create dataset '%s'\n", OBJECT_COPY_COLLECTIVE_TEST_DSET_NAME);
+        goto error;
+    }
+
+    if (NULL == (write_buf = HDmalloc(OBJECT_COPY_COLLECTIVE_TEST_DSET_DIM * sizeof(int)))) {
+        H5_FAILED();
+        HDprintf("    couldn't allocate buffer for dataset write\n");
+        goto error;
+    }
+
+    if (NULL == (read_buf = HDmalloc(OBJECT_COPY_COLLECTIVE_TEST_DSET_DIM * sizeof(int)))) {
+        H5_FAILED();
+        HDprintf("    couldn't allocate buffer for dataset read\n");
+        goto error;
+    }
+
+    for (i = 0; i < OBJECT_COPY_COLLECTIVE_TEST_DSET_DIM; i++)
+        write_buf[i] = (mpi_rank * OBJECT_COPY_COLLECTIVE_TEST_DSET_DIM) + (int)i;
+
+    start[0] = (hsize_t)mpi_rank;
+    start[1] = 0;
+    count[0] = 1;
+    count[1] = OBJECT_COPY_COLLECTIVE_TEST_DSET_DIM;
+
+    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't select hyperslab for dataset write\n");
+        goto error;
+    }
+
+    if ((mspace_id = H5Screate_simple(1, &count[1], NULL)) < 0)
+        TEST_ERROR;
+
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT, write_buf) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't write to dataset '%s'\n", OBJECT_COPY_COLLECTIVE_TEST_DSET_NAME);
+        goto error;
+    }
+
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = H5I_INVALID_HID;
+
+    /*
+     * Make sure all ranks have written their data before the
+     * source group is copied.
+     */
+    if (H5Fflush(file_id, H5F_SCOPE_GLOBAL) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't flush file '%s'\n", vol_test_parallel_filename);
+        goto error;
+    }
+
+    copy_time = 0.0;
+
+    if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+        H5_FAILED();
+        HDprintf("    MPI_Barrier failed\n");
+        goto error;
+    }
+
+    for (i = 0; i < OBJECT_COPY_COLLECTIVE_TEST_NUM_COPIES; i++) {
+        HDsnprintf(object_name, OBJECT_COPY_COLLECTIVE_TEST_NAME_BUF_SIZE, "copy%zu", i);
+
+        start_time = get_wall_time();
+
+        if (H5Ocopy(group_id, OBJECT_COPY_COLLECTIVE_TEST_SRC_NAME, group_id, object_name, H5P_DEFAULT,
+                    H5P_DEFAULT) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't copy group '%s' to '%s'\n", OBJECT_COPY_COLLECTIVE_TEST_SRC_NAME,
+                     object_name);
+            goto error;
+        }
+
+        copy_time += get_wall_time() - start_time;
+    }
+
+    /* Verify the structure of each copy and this rank's portion of the copied data */
+    for (i = 0; i < OBJECT_COPY_COLLECTIVE_TEST_NUM_COPIES; i++) {
+        htri_t committed;
+
+        HDsnprintf(object_name, OBJECT_COPY_COLLECTIVE_TEST_NAME_BUF_SIZE, "copy%zu", i);
+
+        if ((copy_group_id = H5Gopen2(group_id, object_name, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't open copied group '%s'\n", object_name);
+            goto error;
+        }
+
+        memset(&group_info, 0, sizeof(group_info));
+
+        if (H5Gget_info(copy_group_id, &group_info) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't retrieve info for copied group '%s'\n", object_name);
+            goto error;
+        }
+
+        if (group_info.nlinks != OBJECT_COPY_COLLECTIVE_TEST_NUM_SUBGROUPS + 2) {
+            H5_FAILED();
+            HDprintf("    copied group '%s' had %llu links instead of %llu\n", object_name,
+                     (unsigned long long)group_info.nlinks,
+                     (unsigned long long)(OBJECT_COPY_COLLECTIVE_TEST_NUM_SUBGROUPS + 2));
+            goto error;
+        }
+
+        if ((dset_id = H5Dopen2(copy_group_id, OBJECT_COPY_COLLECTIVE_TEST_DSET_NAME, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't open copied dataset in group '%s'\n", object_name);
+            goto error;
+        }
+
+        /* The copied dataset should still use a committed datatype */
+        if ((dset_type_id = H5Dget_type(dset_id)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't retrieve datatype of copied dataset in group '%s'\n", object_name);
+            goto error;
+        }
+
+        if ((committed = H5Tcommitted(dset_type_id)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't determine if datatype of copied dataset is committed\n");
+            goto error;
+        }
+
+        if (!committed) {
+            H5_FAILED();
+            HDprintf("    datatype of copied dataset in group '%s' wasn't committed\n", object_name);
+            goto error;
+        }
+
+        if (H5Tclose(dset_type_id) < 0)
+            TEST_ERROR;
+        dset_type_id = H5I_INVALID_HID;
+
+        memset(read_buf, 0, OBJECT_COPY_COLLECTIVE_TEST_DSET_DIM * sizeof(int));
+
+        if (H5Dread(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, H5P_DEFAULT, read_buf) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't read from copied dataset in group '%s'\n", object_name);
+            goto error;
+        }
+
+        for (j = 0; j < OBJECT_COPY_COLLECTIVE_TEST_DSET_DIM; j++)
+            if (read_buf[j] != write_buf[j]) {
+                H5_FAILED();
+                HDprintf("    copied dataset data in group '%s' didn't match at index %zu: %d != %d\n",
+                         object_name, j, read_buf[j], write_buf[j]);
+                goto error;
+            }
+
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR;
+        dset_id = H5I_INVALID_HID;
+        if (H5Gclose(copy_group_id) < 0)
+            TEST_ERROR;
+        copy_group_id = H5I_INVALID_HID;
+    }
+
+    HDfree(read_buf);
+    read_buf = NULL;
+    HDfree(write_buf);
+    write_buf = NULL;
+
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(fspace_id) < 0)
+        TEST_ERROR;
+    if (H5Tclose(type_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(src_group_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    if (report_parallel_collective_timing("H5Ocopy", copy_time,
+                                          (double)OBJECT_COPY_COLLECTIVE_TEST_NUM_COPIES, "groups") < 0)
+        return 1;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (read_buf)
+            HDfree(read_buf);
+        if (write_buf)
+            HDfree(write_buf);
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Tclose(dset_type_id);
+        H5Tclose(type_id);
+        H5Dclose(dset_id);
+        H5Gclose(copy_group_id);
+        H5Gclose(subgroup_id);
+        H5Gclose(src_group_id);
+        H5Gclose(group_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+/*
+ * A test to check that H5Ovisit3 can be run by all MPI ranks on
+ * an object hierarchy that was created collectively and that every
+ * rank sees the same set of objects.
+ */
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define OBJECT_VISIT_ALL_RANKS_TEST_NUM_GROUPS 32
+#define OBJECT_VISIT_ALL_RANKS_TEST_NUM_VISITS 20
+#else
+#define OBJECT_VISIT_ALL_RANKS_TEST_NUM_GROUPS 4
+#define OBJECT_VISIT_ALL_RANKS_TEST_NUM_VISITS 2
+#endif
+#define OBJECT_VISIT_ALL_RANKS_TEST_GROUP_NAME    "all_ranks_object_visit_test"
+#define OBJECT_VISIT_ALL_RANKS_TEST_DTYPE_NAME    "visit_dtype"
+#define OBJECT_VISIT_ALL_RANKS_TEST_NAME_BUF_SIZE 64
+#define OBJECT_VISIT_ALL_RANKS_TEST_NUM_OBJECTS                                                              \
+    (1 + OBJECT_VISIT_ALL_RANKS_TEST_NUM_GROUPS +                                                            \
+     (OBJECT_VISIT_ALL_RANKS_TEST_NUM_GROUPS * OBJECT_VISIT_ALL_RANKS_TEST_NUM_GROUPS) + 1)
+
+typedef struct object_visit_all_ranks_counts_t {
+    size_t num_groups;
+    size_t num_datatypes;
+    size_t num_other;
+} object_visit_all_ranks_counts_t;
+
+static int
+test_object_visit_all_ranks(void)
+{
+    object_visit_all_ranks_counts_t counts;
+    size_t                          i, j;
+    double                          start_time, visit_time;
+    char                            object_name[OBJECT_VISIT_ALL_RANKS_TEST_NAME_BUF_SIZE];
+    hid_t                           file_id         = H5I_INVALID_HID;
+    hid_t                           fapl_id         = H5I_INVALID_HID;
+    hid_t                           container_group = H5I_INVALID_HID;
+    hid_t                           group_id        = H5I_INVALID_HID;
+    hid_t                           parent_id       = H5I_INVALID_HID;
+    hid_t                           child_id        = H5I_INVALID_HID;
+    hid_t                           type_id         = H5I_INVALID_HID;
+
+    TESTING("H5Ovisit3 by all ranks");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_OBJECT_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_STORED_DATATYPES) || !(vol_cap_flags_g & H5VL_CAP_FLAG_ITERATE)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file, group, object, stored datatype, or iterate aren't "
+                 "supported with this connector\n");
+        return 0;
+    }
+
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, TRUE)) < 0)
+        TEST_ERROR;
+
+    if ((file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open file '%s'\n", vol_test_parallel_filename);
+        goto error;
+    }
+
+    if ((container_group = H5Gopen2(file_id, OBJECT_TEST_GROUP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't open container group '%s'\n", OBJECT_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    if ((group_id = H5Gcreate2(container_group, OBJECT_VISIT_ALL_RANKS_TEST_GROUP_NAME, H5P_DEFAULT,
+                               H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't create container sub-group '%s'\n", OBJECT_VISIT_ALL_RANKS_TEST_GROUP_NAME);
+        goto error;
+    }
+
+    /* Build a two-level hierarchy of groups along with a committed datatype */
+    for (i = 0; i < OBJECT_VISIT_ALL_RANKS_TEST_NUM_GROUPS; i++) {
+        HDsnprintf(object_name, OBJECT_VISIT_ALL_RANKS_TEST_NAME_BUF_SIZE, "group%zu", i);
+
+        if ((parent_id = H5Gcreate2(group_id, object_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            HDprintf("    couldn't create group '%s'\n", object_name);
+            goto error;
+        }
+
+        for (j = 0; j < OBJECT_VISIT_ALL_RANKS_TEST_NUM_GROUPS; j++) {
+            HDsnprintf(object_name, OBJECT_VISIT_ALL_RANKS_TEST_NAME_BUF_SIZE, "subgroup%zu", j);
+
+            if ((child_id = H5Gcreate2(parent_id, object_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+                H5_FAILED();
+                HDprintf("    couldn't create group '%s'\n", object_name);
+                goto error;
+            }
+
+            if (H5Gclose(child_id) < 0)
+                TEST_ERROR;
+            child_id = H5I_INVALID_HID;
+        }
+
+        if (H5Gclose(parent_id) < 0)
+            TEST_ERROR;
+        parent_id = H5I_INVALID_HID;
+    }
+
+    if ((type_id = H5Tcopy(H5T_NATIVE_DOUBLE)) < 0)
+        TEST_ERROR;
+
+    if (H5Tcommit2(group_id, OBJECT_VISIT_ALL_RANKS_TEST_DTYPE_NAME, type_id, H5P_DEFAULT, H5P_DEFAULT,
+                   H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        HDprintf("    couldn't commit datatype '%s'\n", OBJECT_VISIT_ALL_RANKS_TEST_DTYPE_NAME);
+        goto error;
+    }
+
+    visit_time = 0.0;
+
+    if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+        H5_FAILED();
+        HDprintf("    MPI_Barrier failed\n");
+        goto error;
+    }
+
+    for (i = 0; i < OBJECT_VISIT_ALL_RANKS_TEST_NUM_VISITS; i++) {
+        memset(&counts, 0, sizeof(counts));
+
+        start_time = get_wall_time();
+
+        if (H5Ovisit3(group_id, H5_INDEX_NAME, H5_ITER_INC, object_visit_all_ranks_cb, &counts,
+                      H5O_INFO_BASIC) < 0) {
+            H5_FAILED();
+            HDprintf("    H5Ovisit3 failed\n");
+            goto error;
+        }
+
+        visit_time += get_wall_time() - start_time;
+
+        if (counts.num_groups + counts.num_datatypes + counts.num_other !=
+            OBJECT_VISIT_ALL_RANKS_TEST_NUM_OBJECTS) {
+            H5_FAILED();
+            HDprintf("    rank %d visited %zu objects instead of %zu\n", mpi_rank,
+                     counts.num_groups + counts.num_datatypes + counts.num_other,
+                     (size_t)OBJECT_VISIT_ALL_RANKS_TEST_NUM_OBJECTS);
+            goto error;
+        }
+
+        if (counts.num_datatypes != 1 || counts.num_other != 0) {
+            H5_FAILED();
+            HDprintf("    rank %d visited %zu committed datatypes and %zu other objects instead of 1 and 0\n",
+                     mpi_rank, counts.num_datatypes, counts.num_other);
+            goto error;
+        }
+    }
+
+    if (H5Tclose(type_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(container_group) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    /* Every rank visits every object */
+    if (report_parallel_scaling_timing(
+            "H5Ovisit3", visit_time,
+            (double)(OBJECT_VISIT_ALL_RANKS_TEST_NUM_OBJECTS * OBJECT_VISIT_ALL_RANKS_TEST_NUM_VISITS),
+            "objects") < 0)
+        return 1;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Tclose(type_id);
+        H5Gclose(child_id);
+        H5Gclose(parent_id);
+        H5Gclose(group_id);
+        H5Gclose(container_group);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+}
+
+static herr_t
+object_visit_all_ranks_cb(hid_t o_id, const char *name, const H5O_info2_t *object_info, void *op_data)
+{
+    object_visit_all_ranks_counts_t *counts = (object_visit_all_ranks_counts_t *)op_data;
+
+    UNUSED(o_id);
+    UNUSED(name);
+
+    if (object_info->type == H5O_TYPE_GROUP)
+        counts->num_groups++;
+    else if (object_info->type == H5O_TYPE_NAMED_DATATYPE)
+        counts->num_datatypes++;
+    else
+        counts->num_other++;
+
+    return 0;
+}
+
+/*
+ * A benchmark to compare the cost of metadata-heavy operations with
+ * collective metadata reads and writes turned on and off. For each
+ * of the four combinations, all ranks create a set of groups with
+ * attributes, then re-open the file and open objects by path, query
+ * object info, read the attributes and iterate over the links in
+ * the root group. The mean per-operation latency is reported for
+ * each class of operation.
+ */
+#ifdef H5VL_TEST_HAS_BENCHMARKS
+#define OBJECT_COLL_MD_BENCH_NUM_GROUPS     1000
+#define OBJECT_COLL_MD_BENCH_NUM_ATTRS      8
+#define OBJECT_COLL_MD_BENCH_NUM_LINK_ITERS 100
+#else
+#define OBJECT_COLL_MD_BENCH_NUM_GROUPS     16
+#define OBJECT_COLL_MD_BENCH_NUM_ATTRS      4
+#define OBJECT_COLL_MD_BENCH_NUM_LINK_ITERS 4
+#endif
+#define OBJECT_COLL_MD_BENCH_FILE_NAME     "coll_metadata_bench.h5"
+#define OBJECT_COLL_MD_BENCH_SUBGROUP_NAME "subgroup"
+#define OBJECT_COLL_MD_BENCH_NAME_BUF_SIZE 64
+
+typedef enum object_coll_md_bench_op_t {
+    OBJECT_COLL_MD_BENCH_OP_GROUP_CREATE,
+    OBJECT_COLL_MD_BENCH_OP_ATTR_WRITE,
+    OBJECT_COLL_MD_BENCH_OP_FILE_CLOSE,
+    OBJECT_COLL_MD_BENCH_OP_OPEN_BY_PATH,
+    OBJECT_COLL_MD_BENCH_OP_GET_INFO,
+    OBJECT_COLL_MD_BENCH_OP_ATTR_READ,
+    OBJECT_COLL_MD_BENCH_OP_LINK_ITER,
+    OBJECT_COLL_MD_BENCH_NUM_OPS
+} object_coll_md_bench_op_t;
+
+static const char *object_coll_md_bench_op_names[OBJECT_COLL_MD_BENCH_NUM_OPS] = {
+    "H5Gcreate2", "H5Acreate2/H5Awrite", "H5Fclose", "H5Oopen by path", "H5Oget_info_by_name3",
+    "H5Aopen_by_name/H5Aread", "H5Literate2",
+};
+
+static const size_t object_coll_md_bench_op_counts[OBJECT_COLL_MD_BENCH_NUM_OPS] = {
+    2 * OBJECT_COLL_MD_BENCH_NUM_GROUPS,
+    OBJECT_COLL_MD_BENCH_NUM_GROUPS * OBJECT_COLL_MD_BENCH_NUM_ATTRS,
+    1,
+    OBJECT_COLL_MD_BENCH_NUM_GROUPS,
+    OBJECT_COLL_MD_BENCH_NUM_GROUPS,
+    OBJECT_COLL_MD_BENCH_NUM_GROUPS * OBJECT_COLL_MD_BENCH_NUM_ATTRS,
+    OBJECT_COLL_MD_BENCH_NUM_LINK_ITERS,
+};
+
+static int
+test_collective_metadata_benchmark(void)
+{
+    double op_times[OBJECT_COLL_MD_BENCH_NUM_OPS];
+    size_t i, j;
+
+    TESTING_MULTIPART("collective metadata reads/writes on and off");
+
+    /* Make sure the connector supports the API functions being tested */
+    if (!(vol_cap_flags_g & H5VL_CAP_FLAG_FILE_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_GROUP_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_ATTR_BASIC) || !(vol_cap_flags_g & H5VL_CAP_FLAG_OBJECT_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_OBJECT_MORE) || !(vol_cap_flags_g & H5VL_CAP_FLAG_LINK_BASIC) ||
+        !(vol_cap_flags_g & H5VL_CAP_FLAG_ITERATE)) {
+        SKIPPED();
+        HDprintf("    API functions for basic file, group, attribute, object, link, or iterate aren't "
+                 "supported with this connector\n");
+        return 0;
+    }
+
+    BEGIN_MULTIPART
+    {
+        for (i = 0; i < 4; i++) {
+            hbool_t coll_md_read  = (i & 1) ? TRUE : FALSE;
+            hbool_t coll_md_write = (i & 2) ? TRUE : FALSE;
+            char    part_name[OBJECT_COLL_MD_BENCH_NAME_BUF_SIZE];
+
+            PART_BEGIN(coll_md_combination)
+            {
+                HDsnprintf(part_name, sizeof(part_name), "collective metadata reads %s, writes %s",
+                           coll_md_read ? "on" : "off", coll_md_write ? "on" : "off");
+
+                TESTING_2(part_name);
+
+                if (object_coll_md_bench_run(coll_md_read, coll_md_write, op_times) < 0) {
+                    H5_FAILED();
+                    HDprintf("    %s benchmark failed\n", part_name);
+                    PART_ERROR(coll_md_combination);
+                }
+
+                PASSED();
+
+                for (j = 0; j < OBJECT_COLL_MD_BENCH_NUM_OPS; j++)
+                    if (object_coll_md_bench_report(object_coll_md_bench_op_names[j], op_times[j],
+                                                    object_coll_md_bench_op_counts[j]) < 0)
+                        PART_ERROR(coll_md_combination);
+            }
+            PART_END(coll_md_combination);
+        }
+    }
+    END_MULTIPART;
+
+    return 0;
+
+error:
+    return 1;
+}
+
+/*
+ * Runs one combination of the collective metadata benchmark,
+ * returning the time this rank spent on each class of operation.
+ * A failure on any rank is agreed on at the end of each phase,
+ * before the next collective operation, so that all ranks give
+ * up together. Must be called by all MPI ranks.
+ */
+static int
+object_coll_md_bench_run(hbool_t coll_md_read, hbool_t coll_md_write, double *op_times)
+{
+    H5O_info2_t object_info;
+    size_t      i, j;
+    size_t      nlinks;
+    double      start_time;
+    char        obj_path[OBJECT_COLL_MD_BENCH_NAME_BUF_SIZE];
+    char        attr_name[OBJECT_COLL_MD_BENCH_NAME_BUF_SIZE];
+    hid_t       file_id     = H5I_INVALID_HID;
+    hid_t       fapl_id     = H5I_INVALID_HID;
+    hid_t       group_id    = H5I_INVALID_HID;
+    hid_t       subgroup_id = H5I_INVALID_HID;
+    hid_t       attr_id     = H5I_INVALID_HID;
+    hid_t       space_id    = H5I_INVALID_HID;
+    hid_t       obj_id      = H5I_INVALID_HID;
+    int         failed      = 0;
+    int         value;
+
+    for (i = 0; i < OBJECT_COLL_MD_BENCH_NUM_OPS; i++)
+        op_times[i] = 0.0;
+
+    if ((fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, coll_md_read)) < 0)
+        failed = 1;
+    else if (H5Pset_coll_metadata_write(fapl_id, coll_md_write) < 0) {
+        HDprintf("    couldn't set collective metadata write property\n");
+        failed = 1;
+    }
+
+    if (!failed && (space_id = H5Screate(H5S_SCALAR)) < 0)
+        failed = 1;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    if ((file_id = H5Fcreate(OBJECT_COLL_MD_BENCH_FILE_NAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
+        HDprintf("    couldn't create file '%s'\n", OBJECT_COLL_MD_BENCH_FILE_NAME);
+        failed = 1;
+    }
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    for (i = 0; !failed && i < OBJECT_COLL_MD_BENCH_NUM_GROUPS; i++) {
+        HDsnprintf(obj_path, sizeof(obj_path), "group%zu", i);
+
+        start_time = get_wall_time();
+
+        if ((group_id = H5Gcreate2(file_id, obj_path, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+            HDprintf("    couldn't create group '%s'\n", obj_path);
+            failed = 1;
+            break;
+        }
+        if ((subgroup_id = H5Gcreate2(group_id, OBJECT_COLL_MD_BENCH_SUBGROUP_NAME, H5P_DEFAULT,
+                                      H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+            HDprintf("    couldn't create subgroup in group '%s'\n", obj_path);
+            failed = 1;
+            break;
+        }
+
+        op_times[OBJECT_COLL_MD_BENCH_OP_GROUP_CREATE] += get_wall_time() - start_time;
+
+        start_time = get_wall_time();
+
+        for (j = 0; j < OBJECT_COLL_MD_BENCH_NUM_ATTRS; j++) {
+            HDsnprintf(attr_name, sizeof(attr_name), "attr%zu", j);
+
+            value = (int)((i * OBJECT_COLL_MD_BENCH_NUM_ATTRS) + j);
+
+            if ((attr_id = H5Acreate2(group_id, attr_name, H5T_NATIVE_INT, space_id, H5P_DEFAULT,
+                                      H5P_DEFAULT)) < 0) {
+                HDprintf("    couldn't create attribute '%s' on group '%s'\n", attr_name, obj_path);
+                failed = 1;
+                break;
+            }
+            if (H5Awrite(attr_id, H5T_NATIVE_INT, &value) < 0) {
+                HDprintf("    couldn't write attribute '%s' on group '%s'\n", attr_name, obj_path);
+                failed = 1;
+                break;
+            }
+            if (H5Aclose(attr_id) < 0) {
+                failed = 1;
+                break;
+            }
+            attr_id = H5I_INVALID_HID;
+        }
+
+        op_times[OBJECT_COLL_MD_BENCH_OP_ATTR_WRITE] += get_wall_time() - start_time;
+
+        if (failed)
+            break;
+
+        if (H5Gclose(subgroup_id) < 0)
+            failed = 1;
+        subgroup_id = H5I_INVALID_HID;
+        if (H5Gclose(group_id) < 0)
+            failed = 1;
+        group_id = H5I_INVALID_HID;
+    }
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    /* Closing the file writes out all of the new metadata */
+    start_time = get_wall_time();
+
+    if (H5Fclose(file_id) < 0) {
+        HDprintf("    couldn't close file '%s'\n", OBJECT_COLL_MD_BENCH_FILE_NAME);
+        failed = 1;
+    }
+    file_id = H5I_INVALID_HID;
+
+    op_times[OBJECT_COLL_MD_BENCH_OP_FILE_CLOSE] = get_wall_time() - start_time;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    if ((file_id = H5Fopen(OBJECT_COLL_MD_BENCH_FILE_NAME, H5F_ACC_RDONLY, fapl_id)) < 0) {
+        HDprintf("    couldn't open file '%s'\n", OBJECT_COLL_MD_BENCH_FILE_NAME);
+        failed = 1;
+    }
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    start_time = get_wall_time();
+
+    for (i = 0; !failed && i < OBJECT_COLL_MD_BENCH_NUM_GROUPS; i++) {
+        HDsnprintf(obj_path, sizeof(obj_path), "/group%zu/%s", i, OBJECT_COLL_MD_BENCH_SUBGROUP_NAME);
+
+        if ((obj_id = H5Oopen(file_id, obj_path, H5P_DEFAULT)) < 0) {
+            HDprintf("    couldn't open object '%s'\n", obj_path);
+            failed = 1;
+            break;
+        }
+        if (H5Oclose(obj_id) < 0)
+            failed = 1;
+        obj_id = H5I_INVALID_HID;
+    }
+
+    op_times[OBJECT_COLL_MD_BENCH_OP_OPEN_BY_PATH] = get_wall_time() - start_time;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    start_time = get_wall_time();
+
+    for (i = 0; !failed && i < OBJECT_COLL_MD_BENCH_NUM_GROUPS; i++) {
+        HDsnprintf(obj_path, sizeof(obj_path), "/group%zu", i);
+
+        if (H5Oget_info_by_name3(file_id, obj_path, &object_info, H5O_INFO_BASIC | H5O_INFO_NUM_ATTRS,
+                                 H5P_DEFAULT) < 0) {
+            HDprintf("    couldn't get info for object '%s'\n", obj_path);
+            failed = 1;
+        }
+        else if (object_info.type != H5O_TYPE_GROUP ||
+                 object_info.num_attrs != OBJECT_COLL_MD_BENCH_NUM_ATTRS) {
+            HDprintf("    object '%s' had the wrong type or number of attributes\n", obj_path);
+            failed = 1;
+        }
+    }
+
+    op_times[OBJECT_COLL_MD_BENCH_OP_GET_INFO] = get_wall_time() - start_time;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    start_time = get_wall_time();
+
+    for (i = 0; !failed && i < OBJECT_COLL_MD_BENCH_NUM_GROUPS; i++) {
+        HDsnprintf(obj_path, sizeof(obj_path), "/group%zu", i);
+
+        for (j = 0; !failed && j < OBJECT_COLL_MD_BENCH_NUM_ATTRS; j++) {
+            HDsnprintf(attr_name, sizeof(attr_name), "attr%zu", j);
+
+            if ((attr_id = H5Aopen_by_name(file_id, obj_path, attr_name, H5P_DEFAULT, H5P_DEFAULT)) < 0) {
+                HDprintf("    couldn't open attribute '%s' on object '%s'\n", attr_name, obj_path);
+                failed = 1;
+                break;
+            }
+            if (H5Aread(attr_id, H5T_NATIVE_INT, &value) < 0) {
+                HDprintf("    couldn't read attribute '%s' on object '%s'\n", attr_name, obj_path);
+                failed = 1;
+            }
+            else if (value != (int)((i * OBJECT_COLL_MD_BENCH_NUM_ATTRS) + j)) {
+                HDprintf("    attribute '%s' on object '%s' had the wrong value\n", attr_name, obj_path);
+                failed = 1;
+            }
+            if (H5Aclose(attr_id) < 0)
+                failed = 1;
+            attr_id = H5I_INVALID_HID;
+        }
+    }
+
+    op_times[OBJECT_COLL_MD_BENCH_OP_ATTR_READ] = get_wall_time() - start_time;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    start_time = get_wall_time();
+
+    for (i = 0; !failed && i < OBJECT_COLL_MD_BENCH_NUM_LINK_ITERS; i++) {
+        nlinks = 0;
+
+        if (H5Literate2(file_id, H5_INDEX_NAME, H5_ITER_NATIVE, NULL, object_coll_md_bench_link_iter_cb,
+                        &nlinks) < 0) {
+            HDprintf("    couldn't iterate over links in root group\n");
+            failed = 1;
+        }
+        else if (nlinks != OBJECT_COLL_MD_BENCH_NUM_GROUPS) {
+            HDprintf("    link iteration visited %zu links instead of %d\n", nlinks,
+                     OBJECT_COLL_MD_BENCH_NUM_GROUPS);
+            failed = 1;
+        }
+    }
+
+    op_times[OBJECT_COLL_MD_BENCH_OP_LINK_ITER] = get_wall_time() - start_time;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    if (H5Fclose(file_id) < 0)
+        failed = 1;
+    file_id = H5I_INVALID_HID;
+
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    if (H5Fdelete(OBJECT_COLL_MD_BENCH_FILE_NAME, fapl_id) < 0) {
+        HDprintf("    couldn't delete file '%s'\n", OBJECT_COLL_MD_BENCH_FILE_NAME);
+        failed = 1;
+    }
+
+    if (H5Sclose(space_id) < 0)
+        failed = 1;
+    space_id = H5I_INVALID_HID;
+    if (H5Pclose(fapl_id) < 0)
+        failed = 1;
+    fapl_id = H5I_INVALID_HID;
+
+    /* Make sure all ranks fail together before reporting */
+    if (any_parallel_rank_failed(failed))
+        goto error;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Oclose(obj_id);
+        H5Aclose(attr_id);
+        H5Gclose(subgroup_id);
+        H5Gclose(group_id);
+        H5Sclose(space_id);
+        H5Fclose(file_id);
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+
+    return -1;
+}
+
+static herr_t
+object_coll_md_bench_link_iter_cb(hid_t group_id, const char *name, const H5L_info2_t *info, void *op_data)
+{
+    UNUSED(group_id);
+    UNUSED(name);
+    UNUSED(info);
+
+    (*(size_t *)op_data)++;
+
+    return 0;
+}
+
+/*
+ * Prints the mean latency of one class of operation across all
+ * ranks, along with the mean latency on the slowest rank. Must
+ * be called by all MPI ranks.
+ */
+static int
+object_coll_md_bench_report(const char *op_name, double local_time, size_t num_ops)
+{
+    double sum_time, max_time;
+
+    if (MPI_SUCCESS != MPI_Reduce(&local_time, &sum_time, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD))
+        goto error;
+    if (MPI_SUCCESS != MPI_Reduce(&local_time, &max_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD))
+        goto error;
+
+    if (MAINPROCESS)
+        HDprintf("    %-24s mean latency: %10.2f us/op (slowest rank: %10.2f us/op)\n", op_name,
+                 (sum_time / (double)mpi_size) / (double)num_ops * 1e6, max_time / (double)num_ops * 1e6);
+
+    return 0;
+
+error:
+    if (MAINPROCESS)
+        HDprintf("    couldn't collect timings from all ranks for '%s'\n", op_name);
+
+    return -1;
+}
 
 int
 vol_object_test_parallel(void)
@@ -32,7 +1003,7 @@ vol_object_test_parallel(void)
     }
 
     for (i = 0, nerrors = 0; i < ARRAY_LENGTH(par_object_tests); i++) {
-        /* nerrors += (*par_object_tests[i])() ? 1 : 0; */
+        nerrors += run_parallel_test(par_object_tests[i]) ? 1 : 0;
 
         if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
             if (MAINPROCESS)
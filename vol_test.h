@@ -24,11 +24,13 @@
 #define H5VL_VERSION 0
 #endif
 
-/* Define macro to wait forever depending on version */
+/* Define macros to wait forever or not at all depending on version */
 #if H5VL_VERSION >= 2
 #define VOL_TEST_WAIT_FOREVER H5ES_WAIT_FOREVER
+#define VOL_TEST_WAIT_NONE    H5ES_WAIT_NONE
 #else
 #define VOL_TEST_WAIT_FOREVER UINT64_MAX
+#define VOL_TEST_WAIT_NONE    0
 #endif
 
 /* Moved from h5test */
@@ -197,6 +199,23 @@ extern const char *test_path_prefix;
  */
 #define HDF5_API_TEST_PATH_PREFIX "HDF5_API_TEST_PATH_PREFIX"
 
+/*
+ * Environment variable specifying how many seconds the compute
+ * kernel in the async overlap benchmarks should run for, or for
+ * each step of the async checkpoint benchmark. If not set, the
+ * compute time is matched to the time the I/O takes when performed
+ * synchronously.
+ */
+#define HDF5_API_TEST_ASYNC_COMPUTE_TIME "HDF5_API_TEST_ASYNC_COMPUTE_TIME"
+
+/*
+ * Environment variable specifying a file to write a trace of every
+ * async operation performed by the async tests to, in the Chrome
+ * trace event JSON format. In parallel, each rank writes to its own
+ * file, with the rank appended to the name.
+ */
+#define HDF5_API_TEST_ASYNC_TRACE_FILE "HDF5_API_TEST_ASYNC_TRACE_FILE"
+
 /* The names of a set of container groups which hold objects
  * created by each of the different types of tests.
  */
@@ -37,6 +37,14 @@ size_t n_tests_skipped_g;
 int      mpi_size, mpi_rank;
 uint64_t vol_cap_flags_g;
 
+parallel_scaling_mode_t parallel_scaling_mode_g   = PARALLEL_SCALING_WEAK;
+hsize_t                 parallel_scaling_factor_g = 1;
+
+hbool_t parallel_rank_timing_g         = FALSE;
+double  parallel_consensus_wait_time_g = 0.0;
+
+MPI_Info h5_io_info_g = MPI_INFO_NULL;
+
 /* X-macro to define the following for each test:
  * - enum type
  * - name
@@ -169,6 +177,405 @@ error:
     return -1;
 }
 
+/*
+ * Determines the share of a parallel scaling benchmark's work that
+ * belongs to this MPI rank. For weak scaling, each rank gets
+ * `base_size` * the scaling factor units of work. For strong scaling,
+ * that amount of work is instead split as evenly as possible between
+ * all of the ranks. The total amount of work and this rank's offset
+ * into it are also returned, so that the work can be mapped onto a
+ * contiguous selection in a dataset.
+ */
+void
+get_parallel_scaling_share(hsize_t base_size, hsize_t *global_size_out, hsize_t *local_size_out,
+                           hsize_t *local_offset_out)
+{
+    hsize_t scaled_size = base_size * parallel_scaling_factor_g;
+    hsize_t global_size, local_size, local_offset;
+
+    if (parallel_scaling_mode_g == PARALLEL_SCALING_STRONG) {
+        hsize_t per_rank  = scaled_size / (hsize_t)mpi_size;
+        hsize_t remainder = scaled_size % (hsize_t)mpi_size;
+
+        global_size  = scaled_size;
+        local_size   = per_rank + (((hsize_t)mpi_rank < remainder) ? 1 : 0);
+        local_offset = ((hsize_t)mpi_rank * per_rank) + MIN((hsize_t)mpi_rank, remainder);
+    }
+    else {
+        global_size  = scaled_size * (hsize_t)mpi_size;
+        local_size   = scaled_size;
+        local_offset = (hsize_t)mpi_rank * scaled_size;
+    }
+
+    if (global_size_out)
+        *global_size_out = global_size;
+    if (local_size_out)
+        *local_size_out = local_size;
+    if (local_offset_out)
+        *local_offset_out = local_offset;
+}
+
+/*
+ * Reports the timing of work that all MPI ranks take part in
+ * collectively, such as creating an object in a file that all
+ * ranks share. That work is only done once for all of the ranks,
+ * so each rank is credited with an equal share (1/mpi_size) of the
+ * `amount` of work, which keeps the reported total equal to the
+ * work that was actually done. Work that each rank performs by
+ * itself is instead reported with report_parallel_scaling_timing()
+ * and credited to the rank in full. Must be called by all MPI ranks.
+ */
+int
+report_parallel_collective_timing(const char *op_name, double local_time, double amount, const char *unit)
+{
+    return report_parallel_scaling_timing(op_name, local_time, amount / (double)mpi_size, unit);
+}
+
+/*
+ * Closes the given group, file and FAPL, then re-opens the shared
+ * test file read-only and opens the group at `group_path` in it,
+ * with collective or independent metadata reads as requested.
+ * Re-opening the file makes sure that the metadata read by the
+ * test that follows isn't already cached. Once all ranks have the
+ * group open, they are synchronized so that timing can begin
+ * together. Must be called by all MPI ranks.
+ */
+int
+reopen_parallel_test_group(hbool_t coll_md_read, const char *group_path, hid_t *fapl_id, hid_t *file_id,
+                           hid_t *group_id)
+{
+    H5E_BEGIN_TRY
+    {
+        H5Gclose(*group_id);
+        H5Fclose(*file_id);
+        H5Pclose(*fapl_id);
+    }
+    H5E_END_TRY;
+    *group_id = H5I_INVALID_HID;
+    *file_id  = H5I_INVALID_HID;
+    *fapl_id  = H5I_INVALID_HID;
+
+    if ((*fapl_id = create_mpi_fapl(MPI_COMM_WORLD, MPI_INFO_NULL, coll_md_read)) < 0) {
+        HDprintf("    couldn't create FAPL\n");
+        return -1;
+    }
+
+    if ((*file_id = H5Fopen(vol_test_parallel_filename, H5F_ACC_RDONLY, *fapl_id)) < 0) {
+        HDprintf("    couldn't re-open file '%s'\n", vol_test_parallel_filename);
+        return -1;
+    }
+
+    if ((*group_id = H5Gopen2(*file_id, group_path, H5P_DEFAULT)) < 0) {
+        HDprintf("    couldn't open group '%s'\n", group_path);
+        return -1;
+    }
+
+    if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+        HDprintf("    MPI_Barrier failed\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * Collects the time that each MPI rank spent on an operation of a
+ * parallel scaling benchmark, along with the amount of work (bytes,
+ * objects, etc.) that the rank performed, and prints the minimum,
+ * average and maximum per-rank times, the load imbalance between
+ * ranks and the aggregate rate at which the work was completed. The
+ * aggregate rate is based on the slowest rank's time, since that is
+ * how long the operation took as a whole. Must be called by all MPI
+ * ranks.
+ */
+int
+report_parallel_scaling_timing(const char *op_name, double local_time, double local_amount,
+                               const char *unit)
+{
+    double min_time, max_time;
+    double local_sums[2] = {local_time, local_amount};
+    double sums[2]       = {0.0, 0.0};
+
+    if (MPI_SUCCESS != MPI_Reduce(&local_time, &min_time, 1, MPI_DOUBLE, MPI_MIN, 0, MPI_COMM_WORLD))
+        goto error;
+    if (MPI_SUCCESS != MPI_Reduce(&local_time, &max_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD))
+        goto error;
+    if (MPI_SUCCESS != MPI_Reduce(local_sums, sums, 2, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD))
+        goto error;
+
+    if (MAINPROCESS) {
+        double avg_time = sums[0] / (double)mpi_size;
+
+        HDprintf("    %s (%s scaling, %d ranks): %.2f %s in total\n", op_name,
+                 (parallel_scaling_mode_g == PARALLEL_SCALING_STRONG) ? "strong" : "weak", mpi_size, sums[1],
+                 unit);
+        HDprintf("      per-rank time min/avg/max: %.6f/%.6f/%.6f s, load imbalance: %.2f%%\n", min_time,
+                 avg_time, max_time, (avg_time > 0.0) ? ((max_time / avg_time) - 1.0) * 100.0 : 0.0);
+        HDprintf("      aggregate rate: %.2f %s/s\n", (max_time > 0.0) ? sums[1] / max_time : 0.0, unit);
+    }
+
+    return 0;
+
+error:
+    if (MAINPROCESS)
+        HDprintf("    couldn't collect timings from all ranks for '%s'\n", op_name);
+
+    return -1;
+}
+
+/*
+ * Combines a failure flag from every MPI rank, returning non-zero if
+ * the operation failed on any rank. Benchmarks call this before each
+ * collective operation after work that may fail on only some ranks,
+ * so that all ranks give up together instead of leaving the others
+ * waiting in the collective. As with the consensus formed at the end
+ * of non-collective operations, the time spent waiting here counts
+ * towards the per-rank consensus wait time. Must be called by all
+ * MPI ranks.
+ */
+int
+any_parallel_rank_failed(int local_failed)
+{
+    double wait_start_time = MPI_Wtime();
+    int    failed          = local_failed ? 1 : 0;
+
+    if (MPI_SUCCESS != MPI_Allreduce(MPI_IN_PLACE, &failed, 1, MPI_INT, MPI_LOR, MPI_COMM_WORLD))
+        failed = 1;
+
+    parallel_consensus_wait_time_g += MPI_Wtime() - wait_start_time;
+
+    return failed;
+}
+
+/*
+ * Runs a single parallel test. When per-rank timing is enabled, the
+ * time that each rank spent in the test and in waiting for consensus
+ * at the end of non-collective operations is gathered to rank 0, and
+ * the minimum, mean and maximum are reported along with the load
+ * imbalance, i.e. how much longer than the mean the slowest rank took,
+ * as a percentage. Since the slowest rank decides how long a test
+ * takes, a large imbalance shows which operations amplify skew between
+ * ranks. Must be called by all MPI ranks.
+ */
+int
+run_parallel_test(int (*test)(void))
+{
+    double local_times[2];
+    double min_times[2], max_times[2], sum_times[2];
+    double start_time;
+    int    ret;
+
+    if (!parallel_rank_timing_g)
+        return (*test)();
+
+    parallel_consensus_wait_time_g = 0.0;
+
+    start_time = get_wall_time();
+
+    ret = (*test)();
+
+    local_times[0] = get_wall_time() - start_time;
+    local_times[1] = parallel_consensus_wait_time_g;
+
+    if (MPI_SUCCESS != MPI_Reduce(local_times, min_times, 2, MPI_DOUBLE, MPI_MIN, 0, MPI_COMM_WORLD))
+        goto error;
+    if (MPI_SUCCESS != MPI_Reduce(local_times, max_times, 2, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD))
+        goto error;
+    if (MPI_SUCCESS != MPI_Reduce(local_times, sum_times, 2, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD))
+        goto error;
+
+    if (MAINPROCESS) {
+        double mean_time = sum_times[0] / (double)mpi_size;
+
+        HDprintf("    per-rank test time min/mean/max: %.6f/%.6f/%.6f s, load imbalance: %.2f%%\n",
+                 min_times[0], mean_time, max_times[0],
+                 (mean_time > 0.0) ? ((max_times[0] / mean_time) - 1.0) * 100.0 : 0.0);
+        HDprintf("    per-rank consensus wait min/mean/max: %.6f/%.6f/%.6f s\n", min_times[1],
+                 sum_times[1] / (double)mpi_size, max_times[1]);
+    }
+
+    return ret;
+
+error:
+    if (MAINPROCESS)
+        HDprintf("    couldn't collect per-rank test timings\n");
+
+    return ret;
+}
+
+/*
+ * Reads the entire contents of an MPI-IO hints file into a
+ * NUL-terminated buffer, returning the size of the file or
+ * -1 on failure.
+ */
+static long
+read_mpio_hints_file(const char *hints_filename, char **buf_out)
+{
+    FILE *hints_file = NULL;
+    char *buf        = NULL;
+    long  file_size;
+
+    if (NULL == (hints_file = HDfopen(hints_filename, "r")))
+        goto error;
+    if (HDfseek(hints_file, 0, SEEK_END) < 0)
+        goto error;
+    if ((file_size = HDftell(hints_file)) < 0)
+        goto error;
+    if (HDfseek(hints_file, 0, SEEK_SET) < 0)
+        goto error;
+    if (NULL == (buf = HDmalloc((size_t)file_size + 1)))
+        goto error;
+    if (HDfread(buf, 1, (size_t)file_size, hints_file) != (size_t)file_size)
+        goto error;
+
+    buf[file_size] = '\0';
+
+    HDfclose(hints_file);
+
+    *buf_out = buf;
+
+    return file_size;
+
+error:
+    if (buf)
+        HDfree(buf);
+    if (hints_file)
+        HDfclose(hints_file);
+
+    return -1;
+}
+
+/*
+ * Loads the sets of MPI-IO hints given in the specified file (see
+ * HDF5_API_TEST_MPIO_HINTS_FILE for the format) into MPI info
+ * objects. The file is read by rank 0 and broadcast, so this must
+ * be called by all MPI ranks. A copy of each line of the file is
+ * also returned for describing the hint set in test output. The
+ * returned arrays should be freed with free_mpio_hint_sets().
+ */
+int
+load_mpio_hint_sets(const char *hints_filename, MPI_Info **hint_sets_out, char ***hint_set_descs_out,
+                    size_t *num_hint_sets_out)
+{
+    MPI_Info *hint_sets      = NULL;
+    char    **hint_set_descs = NULL;
+    size_t    num_hint_sets  = 0;
+    size_t    max_hint_sets  = 0;
+    char     *file_buf       = NULL;
+    char     *line, *next_line;
+    char     *token;
+    long      file_size = -1;
+
+    if (MAINPROCESS)
+        file_size = read_mpio_hints_file(hints_filename, &file_buf);
+
+    if (MPI_SUCCESS != MPI_Bcast(&file_size, 1, MPI_LONG, 0, MPI_COMM_WORLD))
+        goto error;
+
+    if (file_size < 0) {
+        if (MAINPROCESS)
+            HDfprintf(stderr, "Unable to read MPI-IO hints file '%s'\n", hints_filename);
+        goto error;
+    }
+
+    if (!MAINPROCESS) {
+        if (NULL == (file_buf = HDmalloc((size_t)file_size + 1)))
+            goto error;
+        file_buf[file_size] = '\0';
+    }
+
+    if (MPI_SUCCESS != MPI_Bcast(file_buf, (int)file_size, MPI_CHAR, 0, MPI_COMM_WORLD))
+        goto error;
+
+    for (line = file_buf; line; line = next_line) {
+        if (NULL != (next_line = HDstrchr(line, '\n')))
+            *next_line++ = '\0';
+
+        line += HDstrspn(line, " \t\r");
+
+        /* Skip empty lines and comments */
+        if (*line == '\0' || *line == '#')
+            continue;
+
+        if (num_hint_sets == max_hint_sets) {
+            MPI_Info *tmp_sets;
+            char    **tmp_descs;
+
+            max_hint_sets = (max_hint_sets > 0) ? 2 * max_hint_sets : 8;
+
+            if (NULL == (tmp_sets = HDrealloc(hint_sets, max_hint_sets * sizeof(*hint_sets))))
+                goto error;
+            hint_sets = tmp_sets;
+
+            if (NULL == (tmp_descs = HDrealloc(hint_set_descs, max_hint_sets * sizeof(*hint_set_descs))))
+                goto error;
+            hint_set_descs = tmp_descs;
+        }
+
+        if (NULL == (hint_set_descs[num_hint_sets] = HDstrdup(line)))
+            goto error;
+        hint_set_descs[num_hint_sets][HDstrcspn(hint_set_descs[num_hint_sets], "\r")] = '\0';
+
+        if (MPI_SUCCESS != MPI_Info_create(&hint_sets[num_hint_sets])) {
+            HDfree(hint_set_descs[num_hint_sets]);
+            goto error;
+        }
+
+        num_hint_sets++;
+
+        for (token = HDstrtok(line, " \t\r"); token; token = HDstrtok(NULL, " \t\r")) {
+            char *value;
+
+            if (NULL == (value = HDstrchr(token, '='))) {
+                if (MAINPROCESS)
+                    HDfprintf(stderr, "Malformed MPI-IO hint '%s' in file '%s'\n", token, hints_filename);
+                goto error;
+            }
+
+            *value++ = '\0';
+
+            if (MPI_SUCCESS != MPI_Info_set(hint_sets[num_hint_sets - 1], token, value))
+                goto error;
+        }
+    }
+
+    HDfree(file_buf);
+
+    *hint_sets_out      = hint_sets;
+    *hint_set_descs_out = hint_set_descs;
+    *num_hint_sets_out  = num_hint_sets;
+
+    return 0;
+
+error:
+    free_mpio_hint_sets(hint_sets, hint_set_descs, num_hint_sets);
+
+    if (file_buf)
+        HDfree(file_buf);
+
+    return -1;
+}
+
+/*
+ * Frees the MPI info objects and descriptions returned by
+ * load_mpio_hint_sets().
+ */
+void
+free_mpio_hint_sets(MPI_Info *hint_sets, char **hint_set_descs, size_t num_hint_sets)
+{
+    size_t i;
+
+    for (i = 0; i < num_hint_sets; i++) {
+        MPI_Info_free(&hint_sets[i]);
+        HDfree(hint_set_descs[i]);
+    }
+
+    if (hint_sets)
+        HDfree(hint_sets);
+    if (hint_set_descs)
+        HDfree(hint_set_descs);
+}
+
 int
 main(int argc, char **argv)
 {
@@ -242,6 +649,18 @@ main(int argc, char **argv)
     HDsnprintf(vol_test_parallel_filename, VOL_TEST_FILENAME_MAX_LENGTH, "%s%s", test_path_prefix,
                PARALLEL_TEST_FILE_NAME);
 
+    {
+        const char *scaling_mode   = HDgetenv(HDF5_API_TEST_SCALING_MODE);
+        const char *scaling_factor = HDgetenv(HDF5_API_TEST_SCALING_FACTOR);
+
+        if (scaling_mode && !HDstrcmp(scaling_mode, "strong"))
+            parallel_scaling_mode_g = PARALLEL_SCALING_STRONG;
+        if (scaling_factor && HDstrtoull(scaling_factor, NULL, 10) > 0)
+            parallel_scaling_factor_g = (hsize_t)HDstrtoull(scaling_factor, NULL, 10);
+    }
+
+    parallel_rank_timing_g = (NULL != HDgetenv(HDF5_API_TEST_RANK_TIMING));
+
     if (NULL == (vol_connector_string = HDgetenv("HDF5_VOL_CONNECTOR"))) {
         if (MAINPROCESS)
             HDprintf("No VOL connector selected; using native VOL connector\n");
@@ -285,6 +704,10 @@ main(int argc, char **argv)
         HDprintf("  - Test file name: '%s'\n", vol_test_parallel_filename);
         HDprintf("  - Number of MPI ranks: %d\n", mpi_size);
         HDprintf("  - Test seed: %u\n", seed);
+        HDprintf("  - Scaling mode: %s (scaling factor %llu)\n",
+                 (parallel_scaling_mode_g == PARALLEL_SCALING_STRONG) ? "strong" : "weak",
+                 (unsigned long long)parallel_scaling_factor_g);
+        HDprintf("  - Per-rank test timing: %s\n", parallel_rank_timing_g ? "enabled" : "disabled");
         HDprintf("\n\n");
     }
 
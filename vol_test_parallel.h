@@ -147,25 +147,28 @@ extern char vol_test_parallel_filename[];
 /*
  * Macros to surround an action that will be performed non-collectively. Once the
  * operation has completed, a consensus will be formed by all ranks on whether the
- * operation failed.
+ * operation failed. The time each rank spends waiting for that consensus is added
+ * to parallel_consensus_wait_time_g.
  */
 #define BEGIN_INDEPENDENT_OP(op_name)                                                                        \
     {                                                                                                        \
         hbool_t ind_op_failed = FALSE;                                                                       \
+        double  ind_op_wait_start;                                                                           \
                                                                                                              \
         {
 
 #define END_INDEPENDENT_OP(op_name)                                                                          \
     }                                                                                                        \
                                                                                                              \
-    op_##op_name##_end : if (MPI_SUCCESS != MPI_Allreduce(MPI_IN_PLACE, &ind_op_failed, 1, MPI_C_BOOL,       \
-                                                          MPI_LOR, MPI_COMM_WORLD))                          \
-    {                                                                                                        \
+    op_##op_name##_end : ind_op_wait_start = MPI_Wtime();                                                    \
+    if (MPI_SUCCESS !=                                                                                       \
+        MPI_Allreduce(MPI_IN_PLACE, &ind_op_failed, 1, MPI_C_BOOL, MPI_LOR, MPI_COMM_WORLD)) {               \
         if (MAINPROCESS)                                                                                     \
             HDprintf(                                                                                        \
                 "    failed to collect consensus about whether non-collective operation was successful\n");  \
         goto error;                                                                                          \
     }                                                                                                        \
+    parallel_consensus_wait_time_g += MPI_Wtime() - ind_op_wait_start;                                       \
                                                                                                              \
     if (ind_op_failed) {                                                                                     \
         if (MAINPROCESS)                                                                                     \
@@ -179,10 +182,59 @@ extern char vol_test_parallel_filename[];
     ind_op_failed = TRUE;                                                                                    \
     goto op_##op_name##_end;
 
+/*
+ * Environment variables that control how the parallel scaling benchmarks
+ * divide their work between MPI ranks. HDF5_API_TEST_SCALING_MODE may be
+ * set to "weak" (the default), where each rank's share of the work is
+ * fixed, or "strong", where the total amount of work is fixed and split
+ * between the ranks. HDF5_API_TEST_SCALING_FACTOR multiplies the base
+ * problem size of each benchmark.
+ */
+#define HDF5_API_TEST_SCALING_MODE   "HDF5_API_TEST_SCALING_MODE"
+#define HDF5_API_TEST_SCALING_FACTOR "HDF5_API_TEST_SCALING_FACTOR"
+
+typedef enum parallel_scaling_mode_t {
+    PARALLEL_SCALING_WEAK,
+    PARALLEL_SCALING_STRONG
+} parallel_scaling_mode_t;
+
+/*
+ * Environment variable that enables per-rank timing of the parallel tests.
+ * When set, the time that each rank spent in a test, and in waiting for
+ * other ranks at the end of non-collective operations, is reported after
+ * the test.
+ */
+#define HDF5_API_TEST_RANK_TIMING "HDF5_API_TEST_RANK_TIMING"
+
+/*
+ * Environment variable that names a file of MPI-IO hint sets to run the
+ * parallel dataset tests under. Each line of the file that isn't empty
+ * and doesn't begin with '#' is one hint set, given as whitespace-separated
+ * key=value pairs, e.g. "cb_nodes=4 cb_buffer_size=16777216".
+ */
+#define HDF5_API_TEST_MPIO_HINTS_FILE "HDF5_API_TEST_MPIO_HINTS_FILE"
+
 hid_t create_mpi_fapl(MPI_Comm comm, MPI_Info info, hbool_t coll_md_read);
 int   generate_random_parallel_dimensions(int space_rank, hsize_t **dims_out);
+void  get_parallel_scaling_share(hsize_t base_size, hsize_t *global_size_out, hsize_t *local_size_out,
+                                 hsize_t *local_offset_out);
+int   report_parallel_scaling_timing(const char *op_name, double local_time, double local_amount,
+                                     const char *unit);
+int   report_parallel_collective_timing(const char *op_name, double local_time, double amount,
+                                        const char *unit);
+int   reopen_parallel_test_group(hbool_t coll_md_read, const char *group_path, hid_t *fapl_id, hid_t *file_id,
+                                 hid_t *group_id);
+int   any_parallel_rank_failed(int local_failed);
+int   run_parallel_test(int (*test)(void));
+int   load_mpio_hint_sets(const char *hints_filename, MPI_Info **hint_sets_out, char ***hint_set_descs_out,
+                          size_t *num_hint_sets_out);
+void  free_mpio_hint_sets(MPI_Info *hint_sets, char **hint_set_descs, size_t num_hint_sets);
 
-extern int      mpi_size, mpi_rank;
-extern uint64_t vol_cap_flags_g;
+extern int                     mpi_size, mpi_rank;
+extern uint64_t                vol_cap_flags_g;
+extern parallel_scaling_mode_t parallel_scaling_mode_g;
+extern hsize_t                 parallel_scaling_factor_g;
+extern hbool_t                 parallel_rank_timing_g;
+extern double                  parallel_consensus_wait_time_g;
 
 #endif
@@ -793,3 +793,324 @@ done:
 
     return ret_value;
 }
+
+/*
+ * Returns the current time in seconds according to a
+ * monotonic clock. Used for timing the benchmark tests.
+ */
+double
+get_wall_time(void)
+{
+    struct timespec ts;
+
+    if (HDclock_gettime(CLOCK_MONOTONIC, &ts) < 0)
+        return 0.0;
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1.0E9;
+}
+
+static int
+compare_timings(const void *a, const void *b)
+{
+    double t1 = *(const double *)a;
+    double t2 = *(const double *)b;
+
+    return (t1 > t2) - (t1 < t2);
+}
+
+/*
+ * Sorts an array of timing values in ascending order so
+ * that percentiles can be computed from it.
+ */
+void
+sort_timings(double *timings, size_t ntimings)
+{
+    HDqsort(timings, ntimings, sizeof(*timings), compare_timings);
+}
+
+/*
+ * Returns the value at the given percentile (0-100) of an
+ * array of timing values that has been sorted with
+ * sort_timings().
+ */
+double
+get_timing_percentile(const double *sorted_timings, size_t ntimings, double percentile)
+{
+    size_t idx;
+
+    if (ntimings == 0)
+        return 0.0;
+
+    idx = (size_t)((percentile / 100.0) * (double)(ntimings - 1) + 0.5);
+
+    return sorted_timings[MIN(idx, ntimings - 1)];
+}
+
+/*
+ * A compute kernel for the async benchmarks, standing in for
+ * application computation that async I/O should overlap with.
+ * Each iteration depends on the previous one, so the work can't
+ * be optimized away or vectorized, and no HDF5 calls are made
+ * that could give a connector's progress engine a chance to run.
+ */
+double
+run_compute_kernel(size_t num_iters)
+{
+    volatile double result = 1.0;
+    size_t          i;
+
+    for (i = 0; i < num_iters; i++)
+        result = (result * 1.0000001) + (1.0E-9 * (double)i);
+
+    return result;
+}
+
+/*
+ * Returns the number of iterations of run_compute_kernel() that
+ * this machine performs per second, so that the kernel can be run
+ * for a given amount of time without checking a clock.
+ */
+double
+calibrate_compute_kernel(void)
+{
+    size_t num_iters = 1024;
+    double start_time, elapsed;
+
+    /* Keep doubling the work until it runs for long enough to time reliably */
+    while (1) {
+        start_time = get_wall_time();
+        run_compute_kernel(num_iters);
+        elapsed = get_wall_time() - start_time;
+
+        if (elapsed >= 0.05 || num_iters > (SIZE_MAX / 4))
+            break;
+
+        num_iters *= 2;
+    }
+
+    return (elapsed > 0.0) ? (double)num_iters / elapsed : (double)num_iters;
+}
+
+/*
+ * Returns the resident set size of the process in bytes, or 0
+ * if it can't be determined on this platform. Used by benchmarks
+ * that report how much memory queued operations consume.
+ */
+size_t
+get_resident_memory(void)
+{
+    FILE         *statm_file = NULL;
+    unsigned long resident_pages;
+    long          page_size;
+
+    if (NULL == (statm_file = HDfopen("/proc/self/statm", "r")))
+        return 0;
+
+    if (HDfscanf(statm_file, "%*s %lu", &resident_pages) != 1) {
+        HDfclose(statm_file);
+        return 0;
+    }
+
+    HDfclose(statm_file);
+
+    if ((page_size = HDsysconf(_SC_PAGESIZE)) <= 0)
+        return 0;
+
+    return (size_t)resident_pages * (size_t)page_size;
+}
+
+#ifdef H5ESpublic_H
+
+/*
+ * State for tracing async operations. When a trace file is open,
+ * every event set created with create_test_event_set() has callbacks
+ * registered that write an event to the file when an operation is
+ * inserted into the event set and when it completes. Each event set
+ * is shown as its own thread in the trace, so that operations which
+ * were queued together but completed one after another stand out.
+ */
+static FILE  *async_trace_file_g       = NULL;
+static int    async_trace_pid_g        = 0;
+static size_t async_trace_num_es_g     = 0;
+static size_t async_trace_num_events_g = 0;
+
+/*
+ * Returns the current time in microseconds from the same monotonic
+ * clock that HDF5 uses for the insertion and execution timestamps
+ * of async operations, so that all of the timestamps in a trace can
+ * be compared with each other.
+ */
+static uint64_t
+async_trace_now_usec(void)
+{
+    struct timespec ts;
+
+    if (HDclock_gettime(CLOCK_MONOTONIC, &ts) < 0)
+        return 0;
+
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+static void
+async_trace_begin_event(void)
+{
+    HDfprintf(async_trace_file_g, "%s", async_trace_num_events_g++ ? ",\n" : "");
+}
+
+static int
+async_trace_insert_cb(const H5ES_op_info_t *op_info, void *ctx)
+{
+    size_t es_num = (size_t)(uintptr_t)ctx;
+
+    if (!async_trace_file_g)
+        return 0;
+
+    async_trace_begin_event();
+    HDfprintf(async_trace_file_g,
+              "{\"name\": \"%s\", \"cat\": \"insert\", \"ph\": \"i\", \"s\": \"t\", \"ts\": %llu, "
+              "\"pid\": %d, \"tid\": %zu, \"args\": {\"op\": %llu}}",
+              op_info->api_name ? op_info->api_name : "unknown", (unsigned long long)op_info->op_ins_ts,
+              async_trace_pid_g, es_num, (unsigned long long)op_info->op_ins_count);
+
+    return 0;
+}
+
+static int
+async_trace_complete_cb(const H5ES_op_info_t *op_info, H5ES_status_t status, hid_t H5_ATTR_UNUSED err_stack,
+                        void *ctx)
+{
+    const char *api_name    = op_info->api_name ? op_info->api_name : "unknown";
+    const char *status_name = "unknown";
+    uint64_t    complete_ts = async_trace_now_usec();
+    size_t      es_num      = (size_t)(uintptr_t)ctx;
+
+    if (!async_trace_file_g)
+        return 0;
+
+    if (status == H5ES_STATUS_SUCCEED)
+        status_name = "succeed";
+    else if (status == H5ES_STATUS_FAIL)
+        status_name = "fail";
+    else if (status == H5ES_STATUS_CANCELED)
+        status_name = "canceled";
+
+    /* The span from insertion to completion, on the event set's thread */
+    async_trace_begin_event();
+    HDfprintf(async_trace_file_g,
+              "{\"name\": \"%s\", \"cat\": \"async\", \"ph\": \"X\", \"ts\": %llu, \"dur\": %llu, "
+              "\"pid\": %d, \"tid\": %zu, \"args\": {\"op\": %llu, \"status\": \"%s\", "
+              "\"insert_to_complete_us\": %llu, \"func\": \"%s\", \"line\": %u}}",
+              api_name, (unsigned long long)op_info->op_ins_ts,
+              (unsigned long long)(complete_ts - MIN(complete_ts, op_info->op_ins_ts)), async_trace_pid_g,
+              es_num, (unsigned long long)op_info->op_ins_count, status_name,
+              (unsigned long long)(complete_ts - MIN(complete_ts, op_info->op_ins_ts)),
+              op_info->app_func_name ? op_info->app_func_name : "unknown", op_info->app_line_num);
+
+    /*
+     * If the connector reported when the operation executed, also show
+     * the execution on a single shared thread, where operations that
+     * serialized behind each other appear back to back.
+     */
+    if (op_info->op_exec_ts != 0 && op_info->op_exec_ts != UINT64_MAX &&
+        op_info->op_exec_ts >= op_info->op_ins_ts) {
+        async_trace_begin_event();
+        HDfprintf(async_trace_file_g,
+                  "{\"name\": \"%s\", \"cat\": \"exec\", \"ph\": \"X\", \"ts\": %llu, \"dur\": %llu, "
+                  "\"pid\": %d, \"tid\": 0, \"args\": {\"event_set\": %zu, \"op\": %llu}}",
+                  api_name, (unsigned long long)op_info->op_exec_ts,
+                  (unsigned long long)op_info->op_exec_time, async_trace_pid_g, es_num,
+                  (unsigned long long)op_info->op_ins_count);
+    }
+
+    return 0;
+}
+
+/*
+ * Opens the async trace file named by HDF5_API_TEST_ASYNC_TRACE_FILE,
+ * if set. A non-negative rank is appended to the file name and used
+ * as the process ID in the trace.
+ */
+herr_t
+open_async_trace_file(int rank)
+{
+    const char *trace_file_name = HDgetenv(HDF5_API_TEST_ASYNC_TRACE_FILE);
+    char        file_name[1024];
+
+    if (async_trace_file_g || !trace_file_name || !*trace_file_name)
+        return 0;
+
+    if (rank >= 0)
+        HDsnprintf(file_name, sizeof(file_name), "%s.%d", trace_file_name, rank);
+    else
+        HDsnprintf(file_name, sizeof(file_name), "%s", trace_file_name);
+
+    if (NULL == (async_trace_file_g = HDfopen(file_name, "w"))) {
+        HDprintf("    couldn't open async trace file '%s'\n", file_name);
+        return -1;
+    }
+
+    async_trace_pid_g        = MAX(rank, 0);
+    async_trace_num_es_g     = 0;
+    async_trace_num_events_g = 0;
+
+    HDfprintf(async_trace_file_g, "[\n");
+    async_trace_begin_event();
+    HDfprintf(async_trace_file_g,
+              "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": %d, \"tid\": 0, "
+              "\"args\": {\"name\": \"connector execution\"}}",
+              async_trace_pid_g);
+
+    return 0;
+}
+
+void
+close_async_trace_file(void)
+{
+    if (!async_trace_file_g)
+        return;
+
+    HDfprintf(async_trace_file_g, "\n]\n");
+    HDfclose(async_trace_file_g);
+    async_trace_file_g = NULL;
+}
+
+/*
+ * Creates an event set for the async tests, registering the tracing
+ * callbacks on it if a trace file is open.
+ */
+hid_t
+create_test_event_set(void)
+{
+    hid_t es_id = H5I_INVALID_HID;
+
+    if ((es_id = H5EScreate()) < 0)
+        return H5I_INVALID_HID;
+
+    if (async_trace_file_g) {
+        size_t es_num = ++async_trace_num_es_g;
+
+        if (H5ESregister_insert_func(es_id, async_trace_insert_cb, (void *)(uintptr_t)es_num) < 0)
+            goto error;
+        if (H5ESregister_complete_func(es_id, async_trace_complete_cb, (void *)(uintptr_t)es_num) < 0)
+            goto error;
+
+        async_trace_begin_event();
+        HDfprintf(async_trace_file_g,
+                  "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": %d, \"tid\": %zu, "
+                  "\"args\": {\"name\": \"event set %zu\"}}",
+                  async_trace_pid_g, es_num, es_num);
+    }
+
+    return es_id;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5ESclose(es_id);
+    }
+    H5E_END_TRY;
+
+    return H5I_INVALID_HID;
+}
+
+#endif /* H5ESpublic_H */
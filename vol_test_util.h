@@ -20,5 +20,17 @@ hid_t  generate_random_dataspace(int rank, const hsize_t *max_dims, hsize_t *dim
 int    create_test_container(char *filename, uint64_t vol_cap_flags);
 herr_t prefix_filename(const char *prefix, const char *filename, char **filename_out);
 herr_t remove_test_file(const char *prefix, const char *filename);
+double get_wall_time(void);
+void   sort_timings(double *timings, size_t ntimings);
+double get_timing_percentile(const double *sorted_timings, size_t ntimings, double percentile);
+double run_compute_kernel(size_t num_iters);
+double calibrate_compute_kernel(void);
+size_t get_resident_memory(void);
+
+#ifdef H5ESpublic_H
+herr_t open_async_trace_file(int rank);
+void   close_async_trace_file(void);
+hid_t  create_test_event_set(void);
+#endif
 
 #endif /* VOL_TEST_UTIL_H_ */